@@ -0,0 +1,14 @@
+function test(a, b)
+{
+    return a / b;
+}
+noInline(test);
+
+// A 2048 digit dividend and a 1024 digit divisor, well above the Burnikel-Ziegler cutoff.
+let b = (1n << 65536n) / 7n + 12345n;
+let a = b * ((1n << 65536n) / 3n) + 42n;
+let result;
+for (let i = 0; i < 100; ++i)
+    result = test(a, b);
+if (result !== (1n << 65536n) / 3n)
+    throw new Error("bad result");
@@ -0,0 +1,13 @@
+function test(x, radix)
+{
+    return x.toString(radix);
+}
+noInline(test);
+
+// 1024 digits, well above the divide-and-conquer cutoff for non power of two radixes.
+let x = (1n << 65536n) / 7n;
+let result;
+for (let i = 0; i < 100; ++i)
+    result = test(x, 10);
+if (result.length !== 19728 || result.slice(-1) !== (x % 10n).toString())
+    throw new Error("bad result");
@@ -0,0 +1,14 @@
+function test(a, b)
+{
+    return a * b;
+}
+noInline(test);
+
+// 1024 digit operands, well above the Karatsuba cutoff.
+let a = (1n << 65536n) / 3n;
+let b = (1n << 65536n) / 7n + 12345n;
+let result;
+for (let i = 0; i < 200; ++i)
+    result = test(a, b);
+if (result % 3n !== (a % 3n) * (b % 3n) % 3n)
+    throw new Error("bad result");
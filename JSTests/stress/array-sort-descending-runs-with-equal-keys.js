@@ -0,0 +1,68 @@
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+function checkSortedAndStable(array, length)
+{
+    shouldBe(array.length, length);
+    let seen = new Set;
+    for (let i = 0; i < array.length; ++i) {
+        seen.add(array[i].index);
+        if (!i)
+            continue;
+        let previous = array[i - 1];
+        if (previous.key > array[i].key || (previous.key === array[i].key && previous.index > array[i].index))
+            throw new Error("not sorted or not stable at " + i + ": " + JSON.stringify(previous) + ", " + JSON.stringify(array[i]));
+    }
+    shouldBe(seen.size, length);
+}
+
+function sortAndCheck(keys)
+{
+    let array = keys.map((key, index) => ({ key, index }));
+    array.sort((a, b) => a.key - b.key);
+    checkSortedAndStable(array, keys.length);
+}
+
+// Only strictly descending runs are reversed in place. A descending run with equal keys in it has to end
+// at them, or reversing it would swap the equal keys.
+for (let length of [2, 3, 31, 32, 33, 1000, 20000]) {
+    let descending = [];
+    for (let i = 0; i < length; ++i)
+        descending.push(length - i);
+    sortAndCheck(descending);
+
+    for (let repeat of [2, 3, 17]) {
+        // Every key repeated, like 5, 5, 4, 4, 3, 3.
+        let repeated = [];
+        for (let i = 0; i < length; ++i)
+            repeated.push(Math.floor((length - i) / repeat));
+        sortAndCheck(repeated);
+
+        // Strictly descending except for a single pair of equal keys in the middle.
+        let onePair = descending.slice();
+        onePair[length >> 1] = onePair[(length >> 1) - 1];
+        sortAndCheck(onePair);
+
+        // Descending runs separated by a plateau of equal keys.
+        let plateau = [];
+        for (let i = 0; i < length; ++i)
+            plateau.push(i % (repeat * 8) < repeat ? 0 : length - i);
+        sortAndCheck(plateau);
+    }
+
+    let allEqual = new Array(length).fill(42);
+    sortAndCheck(allEqual);
+}
+
+// A descending comparator sees ascending input as descending runs.
+let ascending = [];
+for (let i = 0; i < 5000; ++i)
+    ascending.push({ key: i >> 1, index: i });
+ascending.sort((a, b) => b.key - a.key);
+for (let i = 1; i < ascending.length; ++i) {
+    let previous = ascending[i - 1];
+    if (previous.key < ascending[i].key || (previous.key === ascending[i].key && previous.index > ascending[i].index))
+        throw new Error("not sorted or not stable at " + i);
+}
@@ -0,0 +1,77 @@
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+// Deterministic, so that a failure reproduces.
+let seed = 0x3c6ef372;
+function random(limit)
+{
+    seed ^= seed << 13;
+    seed ^= seed >>> 17;
+    seed ^= seed << 5;
+    return (seed >>> 0) % limit;
+}
+
+function checkSortedAndStable(array, length)
+{
+    shouldBe(array.length, length);
+    let seen = new Set;
+    for (let i = 0; i < array.length; ++i) {
+        seen.add(array[i].index);
+        if (!i)
+            continue;
+        let previous = array[i - 1];
+        if (previous.key > array[i].key || (previous.key === array[i].key && previous.index > array[i].index))
+            throw new Error("not sorted or not stable at " + i + ": " + JSON.stringify(previous) + ", " + JSON.stringify(array[i]));
+    }
+    shouldBe(seen.size, length);
+}
+
+function sortAndCheck(keys)
+{
+    let array = keys.map((key, index) => ({ key, index }));
+    array.sort((a, b) => a.key - b.key);
+    checkSortedAndStable(array, keys.length);
+}
+
+// Two long ascending runs whose keys interleave in blocks, so that the merge gallops on both runs with
+// equal keys at the end of every streak. Equal keys have to come from the left run first.
+function interleavedRuns(leftLength, rightLength, blockLength)
+{
+    let keys = [];
+    for (let i = 0; i < leftLength; ++i)
+        keys.push(Math.floor(i / blockLength) * 2 * blockLength);
+    for (let i = 0; i < rightLength; ++i)
+        keys.push(Math.floor(i / blockLength) * 2 * blockLength + (i % 2 ? blockLength : 0));
+    return keys;
+}
+
+for (let blockLength of [1, 6, 7, 8, 50, 1000]) {
+    sortAndCheck(interleavedRuns(5000, 5000, blockLength));
+    sortAndCheck(interleavedRuns(9000, 1000, blockLength));
+    sortAndCheck(interleavedRuns(1000, 9000, blockLength));
+}
+
+// Many runs of random lengths with few distinct keys.
+for (let distinctKeys of [2, 10, 1000]) {
+    let keys = [];
+    while (keys.length < 20000) {
+        let runLength = 1 + random(500);
+        let key = random(distinctKeys);
+        for (let i = 0; i < runLength; ++i) {
+            keys.push(key);
+            key = Math.min(distinctKeys - 1, key + random(2));
+        }
+    }
+    sortAndCheck(keys);
+}
+
+// A sorted array with an appended sorted tail that overlaps it: one long merge where the tail's keys all
+// have equal keys in the head.
+let keys = [];
+for (let i = 0; i < 10000; ++i)
+    keys.push(i >> 3);
+for (let i = 0; i < 3000; ++i)
+    keys.push(500 + (i >> 2));
+sortAndCheck(keys);
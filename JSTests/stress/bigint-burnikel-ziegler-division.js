@@ -0,0 +1,84 @@
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+// Deterministic, so that a failure reproduces.
+let seed = 0x7f4a7c15;
+function random32()
+{
+    seed ^= seed << 13;
+    seed ^= seed >>> 17;
+    seed ^= seed << 5;
+    return BigInt(seed >>> 0);
+}
+
+// A positive BigInt of exactly `bits` bits.
+function makeBigInt(bits)
+{
+    let result = 1n;
+    for (let i = 1; i < bits; i += 32)
+        result = (result << 32n) | random32();
+    return result >> BigInt(Math.ceil((bits - 1) / 32) * 32 - (bits - 1));
+}
+
+// Multiplies by one 32-bit chunk of b at a time, so that the check does not depend on Karatsuba.
+function referenceMultiply(a, b)
+{
+    let result = 0n;
+    for (let shift = 0n; b; b >>= 32n, shift += 32n)
+        result += (a * (b & 0xffffffffn)) << shift;
+    return result;
+}
+
+// The quotient and remainder are the only ones with a = q * b + r and 0 <= r < b.
+function check(a, b)
+{
+    let q = a / b;
+    let r = a % b;
+    shouldBe(r >= 0n && r < b, true);
+    shouldBe(referenceMultiply(q, b) + r, a);
+
+    shouldBe(-a / b, -q);
+    shouldBe(-a % b, -r);
+    shouldBe(a / -b, -q);
+    shouldBe(a % -b, r);
+}
+
+function checkExact(b, q, r)
+{
+    let a = referenceMultiply(q, b) + r;
+    shouldBe(a / b, q);
+    shouldBe(a % b, r);
+}
+
+// Burnikel-Ziegler kicks in once both the divisor and the quotient have 80 digits. Its recursion halves
+// the divisor's block size, so also cover divisors of twice that with even and odd lengths. Digits are
+// 64 bits on 64-bit platforms and 32 bits elsewhere, so cover the cutoff for both.
+const burnikelZieglerThreshold = 80;
+for (let digitBits of [64, 32]) {
+    let sizes = [burnikelZieglerThreshold - 1, burnikelZieglerThreshold, burnikelZieglerThreshold + 1];
+    for (let divisorDigits of [...sizes, 2 * burnikelZieglerThreshold, 2 * burnikelZieglerThreshold + 1]) {
+        for (let quotientDigits of [...sizes, 3 * burnikelZieglerThreshold]) {
+            let divisorBits = divisorDigits * digitBits;
+            let quotientBits = quotientDigits * digitBits;
+            let b = makeBigInt(divisorBits);
+            check(makeBigInt(divisorBits + quotientBits), b);
+            check(makeBigInt(divisorBits + quotientBits - 1), b);
+
+            // Remainders of b - 1 and 0 test the final correction steps.
+            let q = makeBigInt(quotientBits);
+            checkExact(b, q, b - 1n);
+            checkExact(b, q, 0n);
+
+            // Quotient digits that are all ones are where estimating a quotient digit overshoots.
+            let ones = (1n << BigInt(quotientBits)) - 1n;
+            checkExact(b, ones, b - 1n);
+
+            // Divisors whose top digit is exactly a power of two need no normalization shift.
+            let power = 1n << BigInt(divisorBits - 1);
+            checkExact(power, q, power - 1n);
+            checkExact(power + 1n, ones, power);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+// Deterministic, so that a failure reproduces.
+let seed = 0x2545f491;
+function random32()
+{
+    seed ^= seed << 13;
+    seed ^= seed >>> 17;
+    seed ^= seed << 5;
+    return BigInt(seed >>> 0);
+}
+
+// A positive BigInt of exactly `bits` bits.
+function makeBigInt(bits)
+{
+    let result = 1n;
+    for (let i = 1; i < bits; i += 32)
+        result = (result << 32n) | random32();
+    return result >> BigInt(Math.ceil((bits - 1) / 32) * 32 - (bits - 1));
+}
+
+// Multiplies by one 32-bit chunk of b at a time, so that every product stays on the schoolbook path.
+function referenceMultiply(a, b)
+{
+    let result = 0n;
+    for (let shift = 0n; b; b >>= 32n, shift += 32n)
+        result += (a * (b & 0xffffffffn)) << shift;
+    return result;
+}
+
+function check(a, b)
+{
+    let expected = referenceMultiply(a, b);
+    shouldBe(a * b, expected);
+    shouldBe(b * a, expected);
+    shouldBe(-a * b, -expected);
+    shouldBe(a * -b, -expected);
+    shouldBe(-a * -b, expected);
+}
+
+// Karatsuba kicks in once both operands have 34 digits, and recurses on halves. Digits are 64 bits on
+// 64-bit platforms and 32 bits elsewhere, so cover the cutoff for both.
+const karatsubaThreshold = 34;
+for (let digitBits of [64, 32]) {
+    for (let digits of [karatsubaThreshold - 1, karatsubaThreshold, karatsubaThreshold + 1, 2 * karatsubaThreshold - 1, 2 * karatsubaThreshold, 2 * karatsubaThreshold + 1]) {
+        let bits = digits * digitBits;
+        let a = makeBigInt(bits);
+        let b = makeBigInt(bits);
+        check(a, b);
+        check(a, a);
+
+        // One digit short of the top, so the operands have different lengths.
+        check(a, makeBigInt(bits - digitBits));
+
+        // Unbalanced operands are multiplied in chunks of the shorter one.
+        check(makeBigInt(6 * bits + 17), b);
+
+        // All ones and powers of two make every carry propagate, or none at all.
+        let ones = (1n << BigInt(bits)) - 1n;
+        check(ones, ones);
+        check(ones, 1n << BigInt(bits - 1));
+        check(ones + 2n, ones);
+
+        // Sparse operands leave whole digits of zeros in the middle terms.
+        let sparse = (1n << BigInt(bits - 1)) | 1n;
+        check(sparse, sparse);
+        check(sparse, a);
+    }
+}
@@ -0,0 +1,68 @@
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+// Deterministic, so that a failure reproduces.
+let seed = 0x1b873593;
+function random32()
+{
+    seed ^= seed << 13;
+    seed ^= seed >>> 17;
+    seed ^= seed << 5;
+    return BigInt(seed >>> 0);
+}
+
+// A positive BigInt of exactly `bits` bits.
+function makeBigInt(bits)
+{
+    let result = 1n;
+    for (let i = 1; i < bits; i += 32)
+        result = (result << 32n) | random32();
+    return result >> BigInt(Math.ceil((bits - 1) / 32) * 32 - (bits - 1));
+}
+
+// Parses a few characters at a time, so that every step multiplies by a single digit.
+function referenceParse(string, radix)
+{
+    const chunkLength = 6;
+    let result = 0n;
+    for (let i = 0; i < string.length; i += chunkLength) {
+        let chunk = string.substring(i, i + chunkLength);
+        let value = parseInt(chunk, radix);
+        shouldBe(value.toString(radix).padStart(chunk.length, "0"), chunk);
+        result = result * BigInt(radix) ** BigInt(chunk.length) + BigInt(value);
+    }
+    return result;
+}
+
+function check(x, radix)
+{
+    let string = x.toString(radix);
+    shouldBe(string[0] !== "0", true);
+    shouldBe(referenceParse(string, radix), x);
+    shouldBe((-x).toString(radix), "-" + string);
+}
+
+// Non power of two radixes switch to divide-and-conquer at 64 digits, which splits the number by powers
+// of radix and must pad each lower half with zeros. Digits are 64 bits on 64-bit platforms and 32 bits
+// elsewhere, so cover the cutoff for both.
+const toStringDivideAndConquerThreshold = 64;
+for (let radix = 2; radix <= 36; ++radix) {
+    for (let digitBits of [64, 32]) {
+        for (let digits of [toStringDivideAndConquerThreshold - 1, toStringDivideAndConquerThreshold, toStringDivideAndConquerThreshold + 1, 2 * toStringDivideAndConquerThreshold + 1]) {
+            let bits = digits * digitBits;
+            check(makeBigInt(bits), radix);
+            check((1n << BigInt(bits)) - 1n, radix);
+            check(1n << BigInt(bits - 1), radix);
+
+            // The smallest and largest numbers with this many characters: a one followed by zeros, which
+            // zero pads every split, and all maximal characters.
+            let length = Math.ceil(bits / Math.log2(radix));
+            let power = BigInt(radix) ** BigInt(length);
+            shouldBe(power.toString(radix), "1" + "0".repeat(length));
+            shouldBe((power - 1n).toString(radix), (radix - 1).toString(radix).repeat(length));
+            shouldBe((power + 1n).toString(radix), "1" + "0".repeat(length - 1) + "1");
+        }
+    }
+}
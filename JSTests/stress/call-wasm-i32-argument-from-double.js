@@ -0,0 +1,34 @@
+//@ skip unless $isWasmPlatform
+
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+// (module (func (export "add") (param i32 i32) (result i32) local.get 0 local.get 1 i32.add))
+const bytes = new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x07, 0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,
+    0x03, 0x02, 0x01, 0x00,
+    0x07, 0x07, 0x01, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00,
+    0x0a, 0x09, 0x01, 0x07, 0x00, 0x20, 0x00, 0x20, 0x01, 0x6a, 0x0b,
+]);
+const add = new WebAssembly.Instance(new WebAssembly.Module(bytes)).exports.add;
+
+// Doubles passed to an i32 parameter go through ToInt32, which the FTL now does inline for CallWasm.
+function callWithDouble(a, b) {
+    return add(a, b);
+}
+noInline(callWithDouble);
+
+const doubles = [0.5, -1.5, 2147483647.5, 2147483648, -2147483649, 4294967301.25, 1e20, -0, NaN, Infinity, -Infinity];
+for (let i = 0; i < testLoopCount; ++i) {
+    const a = doubles[i % doubles.length];
+    const b = i + 0.25;
+    shouldBe(callWithDouble(a, b), ((a | 0) + (b | 0)) | 0);
+}
+
+// A non-number after tier up has to exit rather than be converted as a double.
+shouldBe(callWithDouble("5", 1.5), 6);
+shouldBe(callWithDouble({ valueOf() { return 7.9; } }, 1), 8);
+shouldBe(callWithDouble(undefined, 1), 1);
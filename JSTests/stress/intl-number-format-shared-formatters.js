@@ -0,0 +1,32 @@
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+$vm.clearIntlCacheStats();
+let first = new Intl.NumberFormat("en-US", { style: "currency", currency: "EUR" });
+let stats = $vm.intlCacheStats();
+shouldBe(stats.numberFormatMisses, 1);
+shouldBe(stats.numberFormatHits, 0);
+
+// Same locale and options: shares the ICU formatters of the first one.
+let second = new Intl.NumberFormat("en-US", { style: "currency", currency: "EUR" });
+stats = $vm.intlCacheStats();
+shouldBe(stats.numberFormatMisses, 1);
+shouldBe(stats.numberFormatHits, 1);
+shouldBe(second.format(1234.5), first.format(1234.5));
+shouldBe(second.formatRange(1, 5), first.formatRange(1, 5));
+shouldBe(second.format(12345678901234567890n), first.format(12345678901234567890n));
+
+// Different options must not share.
+let other = new Intl.NumberFormat("en-US", { style: "currency", currency: "USD" });
+shouldBe($vm.intlCacheStats().numberFormatMisses, 2);
+if (other.format(1) === first.format(1))
+    throw new Error("USD and EUR formatted the same");
+
+// Shared formatters must outlive the NumberFormats that created them.
+for (let i = 0; i < 100; ++i)
+    (1234.5).toLocaleString("de-DE", { style: "unit", unit: ["meter", "liter", "second", "byte", "hour", "gram", "foot", "mile", "day", "acre"][i % 10] });
+first = null;
+fullGC();
+shouldBe(second.format(1234.5), other.format(1234.5).replace("$", "€"));
@@ -0,0 +1,249 @@
+function shouldBe(actual, expected) {
+    if (!Object.is(actual, expected))
+        throw new Error("bad value: " + String(actual) + " expected: " + String(expected));
+}
+
+// Small Maps and Sets start with room for 4 entries, fill every slot up to 8, and then grow, rehash away
+// deleted entries and shrink like larger tables. Check every size up to 40 against a model that follows
+// the spec: a list of entries in which deleted entries are left behind as holes.
+class Model {
+    constructor() { this.entries = []; }
+    indexOf(key)
+    {
+        for (let i = 0; i < this.entries.length; ++i) {
+            let entry = this.entries[i];
+            if (entry && (entry.key === key || (key !== key && entry.key !== entry.key)))
+                return i;
+        }
+        return -1;
+    }
+    set(key, value)
+    {
+        let index = this.indexOf(key);
+        if (index >= 0)
+            this.entries[index].value = value;
+        else
+            this.entries.push({ key: Object.is(key, -0) ? 0 : key, value });
+    }
+    delete(key)
+    {
+        let index = this.indexOf(key);
+        if (index < 0)
+            return false;
+        this.entries[index] = null;
+        return true;
+    }
+    get size() { return this.entries.filter((entry) => entry).length; }
+    // Like the iterators of Map and Set, this sees entries added after it was created.
+    *[Symbol.iterator]()
+    {
+        for (let i = 0; i < this.entries.length; ++i) {
+            if (this.entries[i])
+                yield this.entries[i];
+        }
+    }
+}
+
+let objectKeys = [];
+for (let i = 0; i < 50; ++i)
+    objectKeys.push({ i });
+
+// Keys of every kind, so that they land in all kinds of buckets and chains.
+function keyFor(i)
+{
+    switch (i % 6) {
+    case 0: return i;
+    case 1: return "key" + i;
+    case 2: return objectKeys[i % objectKeys.length];
+    case 3: return i + 0.5;
+    case 4: return Symbol.for("symbol" + i);
+    default: return BigInt(i) << 70n;
+    }
+}
+const specialKeys = [-0, NaN, undefined, null, true, ""];
+const universe = [...Array(120).keys()].map(keyFor).concat(specialKeys);
+
+function adapterFor(isMap)
+{
+    if (isMap) {
+        return {
+            create: () => new Map,
+            set: (collection, key, value) => shouldBe(collection.set(key, value), collection),
+            entryOf: (item) => ({ key: item[0], value: item[1] }),
+            check(collection, key, entry) {
+                shouldBe(collection.has(key), !!entry);
+                shouldBe(collection.get(key), entry ? entry.value : undefined);
+            },
+        };
+    }
+    return {
+        create: () => new Set,
+        set: (collection, key) => shouldBe(collection.add(key), collection),
+        entryOf: (item) => ({ key: item, value: undefined }),
+        check(collection, key, entry) { shouldBe(collection.has(key), !!entry); },
+    };
+}
+
+function check(adapter, collection, model)
+{
+    shouldBe(collection.size, model.size);
+    let expected = [...model];
+    let index = 0;
+    for (let item of collection) {
+        let entry = adapter.entryOf(item);
+        shouldBe(entry.key, expected[index].key);
+        shouldBe(entry.value, expected[index].value);
+        ++index;
+    }
+    shouldBe(index, expected.length);
+    for (let key of universe) {
+        let modelIndex = model.indexOf(key);
+        adapter.check(collection, key, modelIndex >= 0 ? model.entries[modelIndex] : null);
+    }
+}
+
+function set(adapter, collection, model, key, value)
+{
+    adapter.set(collection, key, value);
+    model.set(key, adapter === setAdapter ? undefined : value);
+}
+
+function remove(collection, model, key)
+{
+    shouldBe(collection.delete(key), model.delete(key));
+}
+
+const mapAdapter = adapterFor(true);
+const setAdapter = adapterFor(false);
+
+function testGrowth(adapter, size)
+{
+    let collection = adapter.create();
+    let model = new Model;
+    for (let i = 0; i < size; ++i) {
+        set(adapter, collection, model, keyFor(i), i);
+        check(adapter, collection, model);
+    }
+    // Overwriting does not add entries.
+    for (let i = 0; i < size; ++i)
+        set(adapter, collection, model, keyFor(i), -i);
+    check(adapter, collection, model);
+    for (let key of specialKeys)
+        set(adapter, collection, model, key, "special");
+    check(adapter, collection, model);
+}
+
+// Deleting and adding at a steady size fills the table with deleted entries, which are cleared by
+// rehashing at the same capacity rather than growing.
+function testDeleteHeavy(adapter, size)
+{
+    let collection = adapter.create();
+    let model = new Model;
+    for (let i = 0; i < size; ++i)
+        set(adapter, collection, model, keyFor(i), i);
+    for (let round = 0; round < 3 * size + 8; ++round) {
+        remove(collection, model, keyFor(round));
+        remove(collection, model, keyFor(round));
+        set(adapter, collection, model, keyFor(round + size), round);
+        if (round % 3 === 0)
+            check(adapter, collection, model);
+    }
+    check(adapter, collection, model);
+
+    // Delete every other entry, then add them back at the end.
+    for (let i = 0; i < 4 * size + 8; i += 2)
+        remove(collection, model, keyFor(i));
+    check(adapter, collection, model);
+    for (let i = 0; i < 4 * size + 8; i += 2)
+        set(adapter, collection, model, keyFor(i), i);
+    check(adapter, collection, model);
+}
+
+// Removing almost everything shrinks the table, after which it has to grow again.
+function testShrink(adapter, size)
+{
+    let collection = adapter.create();
+    let model = new Model;
+    for (let i = 0; i < size; ++i)
+        set(adapter, collection, model, keyFor(i), i);
+    for (let i = 0; i < size - 1; ++i) {
+        remove(collection, model, keyFor(i));
+        check(adapter, collection, model);
+    }
+    for (let i = 0; i < size; ++i)
+        set(adapter, collection, model, keyFor(i + 60), i);
+    check(adapter, collection, model);
+    for (let i = 0; i < size + 60; ++i)
+        remove(collection, model, keyFor(i));
+    check(adapter, collection, model);
+    set(adapter, collection, model, keyFor(0), 0);
+    check(adapter, collection, model);
+    collection.clear();
+    model = new Model;
+    check(adapter, collection, model);
+}
+
+// Iterators have to follow the entries across every rehash, including ones that happen while the
+// iterator is suspended in the middle of the table.
+function testIterationDuringGrowth(adapter, size)
+{
+    let collection = adapter.create();
+    let model = new Model;
+    set(adapter, collection, model, keyFor(0), 0);
+    let visited = 0;
+    let next = 1;
+    let modelIterator = model[Symbol.iterator]();
+    for (let item of collection) {
+        let entry = adapter.entryOf(item);
+        shouldBe(entry.key, modelIterator.next().value.key);
+        ++visited;
+        if (next < size)
+            set(adapter, collection, model, keyFor(next), next++);
+        if (next < size)
+            set(adapter, collection, model, keyFor(next), next++);
+    }
+    shouldBe(visited, size);
+    shouldBe(modelIterator.next().done, true);
+
+    // Delete entries ahead of and behind the iterator, and add new ones, while iterating.
+    let iterator = collection[Symbol.iterator]();
+    modelIterator = model[Symbol.iterator]();
+    for (let step = 0; ; ++step) {
+        let result = iterator.next();
+        let expected = modelIterator.next();
+        shouldBe(result.done, expected.done);
+        if (result.done)
+            break;
+        shouldBe(adapter.entryOf(result.value).key, expected.value.key);
+        remove(collection, model, keyFor(step + 1));
+        remove(collection, model, keyFor(step - 1));
+        if (step < size)
+            set(adapter, collection, model, keyFor(step + 61), step);
+    }
+    check(adapter, collection, model);
+
+    // An iterator suspended while the table shrinks to nothing and grows again.
+    iterator = collection[Symbol.iterator]();
+    modelIterator = model[Symbol.iterator]();
+    for (let i = 0; i < size + 61; ++i)
+        remove(collection, model, keyFor(i));
+    for (let i = 0; i < size; ++i)
+        set(adapter, collection, model, keyFor(i + 100), i);
+    for (;;) {
+        let result = iterator.next();
+        let expected = modelIterator.next();
+        shouldBe(result.done, expected.done);
+        if (result.done)
+            break;
+        shouldBe(adapter.entryOf(result.value).key, expected.value.key);
+    }
+}
+
+for (let adapter of [mapAdapter, setAdapter]) {
+    for (let size = 1; size <= 40; ++size) {
+        testGrowth(adapter, size);
+        testDeleteHeavy(adapter, size);
+        testShrink(adapter, size);
+        testIterationDuringGrowth(adapter, size);
+    }
+}
@@ -0,0 +1,46 @@
+//@ runDefault
+
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+function resolve(string) {
+    return string.indexOf("#");
+}
+
+function check(result, piece, count, offset) {
+    for (let i = 0; i < count; i += 97)
+        shouldBe(result.substring(offset + i * piece.length, offset + (i + 1) * piece.length), piece);
+}
+
+const count = 2500;
+const latin1 = "abcdefgh";
+const utf16 = "☃bcdefgh";
+
+$vm.clearRopeResolutionStats();
+let result = "";
+for (let i = 0; i < count; ++i) {
+    result += latin1;
+    resolve(result);
+}
+// Copying the whole prefix on every iteration would be about 25MB.
+let stats = $vm.ropeResolutionStats();
+if (stats.copiedBytes > 16 * result.length)
+    throw new Error("8-bit chain copied " + stats.copiedBytes + " bytes");
+shouldBe(result.length, latin1.length * count);
+check(result, latin1, count, 0);
+
+// The first 16-bit rope starts with an 8-bit string, so it cannot append to the 8-bit buffer.
+const latin1Length = result.length;
+$vm.clearRopeResolutionStats();
+for (let i = 0; i < count; ++i) {
+    result += utf16;
+    resolve(result);
+}
+stats = $vm.ropeResolutionStats();
+if (stats.copiedBytes > 16 * 2 * result.length)
+    throw new Error("16-bit chain copied " + stats.copiedBytes + " bytes");
+shouldBe(result.length, latin1Length + utf16.length * count);
+check(result, latin1, count, 0);
+check(result, utf16, count, latin1Length);
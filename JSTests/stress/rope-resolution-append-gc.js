@@ -0,0 +1,30 @@
+//@ runDefault
+
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+function resolve(string) {
+    return string.indexOf("#");
+}
+
+let results = [];
+let result = "";
+for (let i = 0; i < 3000; ++i) {
+    result += i % 2 ? "abcdefgh" : "ABCDEFGH";
+    resolve(result);
+    // A full GC drops the append buffer while strings that share it are still alive.
+    if (!(i % 250)) {
+        results.push(result);
+        fullGC();
+    }
+}
+
+shouldBe(result.length, 24000);
+for (let i = 0; i < results.length; ++i) {
+    let saved = results[i];
+    shouldBe(saved.length, (i * 250 + 1) * 8);
+    shouldBe(saved.substring(saved.length - 8), "ABCDEFGH");
+    shouldBe(result.substring(0, saved.length), saved);
+}
@@ -0,0 +1,45 @@
+//@ runDefault
+
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+function resolve(string) {
+    return string.indexOf("#");
+}
+
+// Leaves an 8-bit append buffer behind.
+let latin1 = "";
+for (let i = 0; i < 300; ++i) {
+    latin1 += "abcdefgh";
+    resolve(latin1);
+}
+
+// A 16-bit substring prefix must not be compared against the 8-bit buffer.
+let utf16 = "☃".repeat(4000);
+resolve(utf16);
+let prefix = utf16.substring(1);
+resolve(prefix);
+let rope = prefix + "☃x";
+resolve(rope);
+shouldBe(rope.length, 4001);
+shouldBe(rope.charCodeAt(3999), 0x2603);
+shouldBe(rope[4000], "x");
+
+// Alternate between widths so that every switch has to start over.
+let result = "";
+let expectedLength = 0;
+for (let i = 0; i < 2000; ++i) {
+    let piece = i % 3 ? "abcd" : "é☃cd";
+    result += piece;
+    expectedLength += piece.length;
+    resolve(result);
+    if (!(i % 101)) {
+        shouldBe(result.length, expectedLength);
+        shouldBe(result.substring(expectedLength - piece.length), piece);
+    }
+}
+shouldBe(result.length, expectedLength);
+shouldBe(latin1.length, 2400);
+shouldBe(latin1.substring(2392), "abcdefgh");
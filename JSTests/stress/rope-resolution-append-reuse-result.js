@@ -0,0 +1,46 @@
+//@ runDefault
+
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+function resolve(string) {
+    return string.indexOf("#");
+}
+
+let base = "";
+for (let i = 0; i < 500; ++i) {
+    base += "abcdefgh";
+    resolve(base);
+}
+
+// Both ropes start with base. Only the first one may write past it; the second one must not see or
+// overwrite those characters.
+let first = base + "first";
+resolve(first);
+let second = base + "second";
+resolve(second);
+shouldBe(first.substring(4000), "first");
+shouldBe(second.substring(4000), "second");
+
+// Keep appending to first after the buffer moved on to second.
+for (let i = 0; i < 500; ++i) {
+    first += "12345678";
+    resolve(first);
+}
+shouldBe(second.substring(4000), "second");
+shouldBe(base.length, 4000);
+shouldBe(base.substring(3992), "abcdefgh");
+shouldBe(first.length, 4005 + 4000);
+shouldBe(first.substring(4000, 4005), "first");
+shouldBe(first.substring(first.length - 8), "12345678");
+
+// An older result of the chain must not be treated as the current one.
+let older = first.substring(0, 6000);
+resolve(older);
+let branched = older + "!";
+resolve(branched);
+shouldBe(branched.length, 6001);
+shouldBe(branched[6000], "!");
+shouldBe(first[6000], first[6008]);
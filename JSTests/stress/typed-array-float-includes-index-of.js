@@ -0,0 +1,111 @@
+function shouldBe(actual, expected) {
+    if (!Object.is(actual, expected))
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+function normalize(array, fromIndex)
+{
+    return fromIndex < 0 ? Math.max(array.length + fromIndex, 0) : fromIndex;
+}
+
+function referenceIndexOf(array, value, fromIndex)
+{
+    fromIndex = normalize(array, fromIndex);
+    for (let i = fromIndex; i < array.length; ++i) {
+        if (array[i] === value)
+            return i;
+    }
+    return -1;
+}
+
+function referenceIncludes(array, value, fromIndex)
+{
+    fromIndex = normalize(array, fromIndex);
+    for (let i = fromIndex; i < array.length; ++i) {
+        if (array[i] === value || (value !== value && array[i] !== array[i]))
+            return true;
+    }
+    return false;
+}
+
+function check(array, value, fromIndex)
+{
+    shouldBe(array.indexOf(value, fromIndex), referenceIndexOf(array, value, fromIndex));
+    shouldBe(array.includes(value, fromIndex), referenceIncludes(array, value, fromIndex));
+}
+
+// Searches go through vectors of several lanes, so cover lengths around the vector widths, values in
+// every position including the tail, and subarrays starting at every alignment.
+for (let TypedArray of [Float32Array, Float64Array]) {
+    let buffer = new TypedArray(100 + 8);
+    for (let start = 0; start < 8; ++start) {
+        for (let length = 0; length <= 100; length += length < 40 ? 1 : 13) {
+            let array = buffer.subarray(start, start + length);
+            for (let i = 0; i < length; ++i)
+                array[i] = i + 1.25;
+
+            check(array, NaN, 0);
+            check(array, 0, 0);
+            check(array, -0, 0);
+            check(array, length + 1.25, 0);
+
+            for (let position of [0, 1, length >> 1, length - 2, length - 1]) {
+                if (position < 0 || position >= length)
+                    continue;
+                let saved = array[position];
+
+                array[position] = NaN;
+                check(array, NaN, 0);
+                check(array, NaN, position);
+                check(array, NaN, position + 1);
+                check(array, saved, 0);
+
+                // +0 and -0 are equal both to indexOf and to includes.
+                array[position] = -0;
+                check(array, 0, 0);
+                check(array, -0, 0);
+                check(array, 0, position + 1);
+                array[position] = 0;
+                check(array, -0, 0);
+
+                array[position] = Infinity;
+                check(array, Infinity, 0);
+                check(array, -Infinity, 0);
+
+                array[position] = saved;
+                check(array, saved, 0);
+                check(array, saved, position);
+                check(array, saved, position + 1);
+                check(array, saved, -1);
+            }
+
+            // A value that only exists in the parent array, just outside of the subarray.
+            buffer[start + length] = NaN;
+            check(array, NaN, 0);
+            buffer[start + length] = 0;
+        }
+    }
+}
+
+// Float32 rounds the search value: a double that is not exactly representable is never found.
+let float32 = new Float32Array([0.1, 0.5, 16777217, 1e40, -1e40]);
+shouldBe(float32.indexOf(0.1), -1);
+shouldBe(float32.includes(0.1), false);
+shouldBe(float32.indexOf(Math.fround(0.1)), 0);
+shouldBe(float32.indexOf(0.5), 1);
+shouldBe(float32.indexOf(16777216), 2);
+shouldBe(float32.indexOf(16777217), -1);
+shouldBe(float32.indexOf(Infinity), 3);
+shouldBe(float32.indexOf(-Infinity), 4);
+
+// NaNs with different payloads are all NaN.
+let float64 = new Float64Array(40);
+new Uint32Array(float64.buffer)[2 * 37 + 1] = 0x7ff00001;
+shouldBe(float64.includes(NaN), true);
+shouldBe(float64.indexOf(NaN), -1);
+new Uint32Array(float64.buffer)[2 * 37 + 1] = 0xfff80000;
+shouldBe(float64.includes(NaN), true);
+float32 = new Float32Array(40);
+new Uint32Array(float32.buffer)[33] = 0xffc00001;
+shouldBe(float32.includes(NaN), true);
+shouldBe(float32.includes(NaN, 34), false);
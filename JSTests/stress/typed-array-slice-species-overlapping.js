@@ -0,0 +1,82 @@
+function shouldBe(actual, expected) {
+    if (!Object.is(actual, expected))
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+// When the species constructor returns a view on the same buffer, slice of a different type reads each
+// element after storing the previous one, so elements already overwritten are read as they are now.
+const types = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array];
+const bufferLength = 256;
+const sourceByteOffset = 64;
+
+function fill(source)
+{
+    for (let i = 0; i < source.length; ++i)
+        source[i] = (i % 2 ? -1 : 1) * (i * 37 + 1.5);
+}
+
+function sliceWithSpecies(Source, Target, targetByteOffset, start, end)
+{
+    let buffer = new ArrayBuffer(bufferLength);
+    let source = new Source(buffer, sourceByteOffset, 16);
+    fill(source);
+    source.constructor = {
+        [Symbol.species]: function(length) {
+            return new Target(buffer, targetByteOffset, length);
+        }
+    };
+    let result = source.slice(start, end);
+    shouldBe(result.buffer, buffer);
+    return new Uint8Array(buffer);
+}
+
+// The same copy, done one element at a time.
+function sliceByHand(Source, Target, targetByteOffset, start, end)
+{
+    let buffer = new ArrayBuffer(bufferLength);
+    let source = new Source(buffer, sourceByteOffset, 16);
+    fill(source);
+    let target = new Target(buffer, targetByteOffset, end - start);
+    for (let k = start, n = 0; k < end; ++k, ++n)
+        target[n] = source[k];
+    return new Uint8Array(buffer);
+}
+
+for (let Source of types) {
+    for (let Target of types) {
+        for (let delta = -24; delta <= 24; delta += Target.BYTES_PER_ELEMENT) {
+            for (let [start, end] of [[0, 16], [1, 11], [5, 6]]) {
+                let targetByteOffset = sourceByteOffset + delta;
+                let actual = sliceWithSpecies(Source, Target, targetByteOffset, start, end);
+                let expected = sliceByHand(Source, Target, targetByteOffset, start, end);
+                for (let i = 0; i < bufferLength; ++i) {
+                    if (actual[i] !== expected[i])
+                        throw new Error(Source.name + " to " + Target.name + " at byte offset " + delta + ", slice(" + start + ", " + end + "): byte " + i + " is " + actual[i] + ", expected " + expected[i]);
+                }
+            }
+        }
+    }
+}
+
+// The same, with BigInt arrays.
+for (let Source of [BigInt64Array, BigUint64Array]) {
+    for (let Target of [BigInt64Array, BigUint64Array]) {
+        for (let delta = -24; delta <= 24; delta += 8) {
+            let buffer = new ArrayBuffer(bufferLength);
+            let source = new Source(buffer, sourceByteOffset, 8);
+            for (let i = 0; i < source.length; ++i)
+                source[i] = BigInt(i * 37 + 1) * (i % 2 ? -1n : 1n);
+            let copy = new BigInt64Array(buffer.slice(0));
+            source.constructor = { [Symbol.species]: function(length) { return new Target(buffer, sourceByteOffset + delta, length); } };
+            source.slice(1, 7);
+
+            let expectedSource = new Source(copy.buffer, sourceByteOffset, 8);
+            let expectedTarget = new Target(copy.buffer, sourceByteOffset + delta, 6);
+            for (let k = 1, n = 0; k < 7; ++k, ++n)
+                expectedTarget[n] = expectedSource[k];
+            let actual = new BigInt64Array(buffer);
+            for (let i = 0; i < actual.length; ++i)
+                shouldBe(actual[i], copy[i]);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+function shouldBe(actual, expected) {
+    if (actual !== expected)
+        throw new Error("bad value: " + actual + " expected: " + expected);
+}
+
+// Deterministic, so that a failure reproduces.
+let seed = 0x6a09e667;
+function random(min, max)
+{
+    seed ^= seed << 13;
+    seed ^= seed >>> 17;
+    seed ^= seed << 5;
+    return min + (seed >>> 0) % (max - min + 1);
+}
+
+function check(array)
+{
+    let expected = Array.from(array).sort((a, b) => a - b);
+    shouldBe(array.sort(), array);
+    for (let i = 0; i < array.length; ++i) {
+        if (!Object.is(array[i], expected[i]))
+            throw new Error(array.constructor.name + " of length " + array.length + " differs at " + i + ": " + array[i] + " expected: " + expected[i]);
+    }
+}
+
+// 8-bit and 16-bit arrays are counting sorted from 64 and 4096 elements respectively, and std::sorted
+// below that.
+const types = [
+    [Int8Array, -128, 127, [63, 64, 65, 256, 10000]],
+    [Uint8Array, 0, 255, [63, 64, 65, 256, 10000]],
+    [Uint8ClampedArray, 0, 255, [63, 64, 65, 256, 10000]],
+    [Int16Array, -32768, 32767, [63, 64, 4095, 4096, 4097, 70000]],
+    [Uint16Array, 0, 65535, [63, 64, 4095, 4096, 4097, 70000]],
+];
+
+for (let [TypedArray, min, max, lengths] of types) {
+    for (let length of lengths) {
+        let array = new TypedArray(length);
+        for (let i = 0; i < length; ++i)
+            array[i] = random(min, max);
+        // The extremes, and -0, which stores as 0.
+        array[0] = max;
+        array[length >> 1] = min;
+        array[length - 1] = -0;
+        array[length - 2] = min;
+        array[length - 3] = max;
+        check(array);
+        shouldBe(array[0], min);
+        shouldBe(array[length - 1], max);
+
+        // Few distinct values, and all equal.
+        for (let i = 0; i < length; ++i)
+            array[i] = i % 3 ? min : max;
+        check(array);
+        array.fill(-0);
+        check(array);
+        shouldBe(Object.is(array[0], 0), true);
+
+        // Already sorted, and reversed.
+        for (let i = 0; i < length; ++i)
+            array[i] = min + i % (max - min + 1);
+        check(array);
+        array.reverse();
+        check(array);
+
+        // Only the subarray is sorted. The elements around it must not move.
+        let buffer = new TypedArray(length + 2);
+        for (let i = 0; i < buffer.length; ++i)
+            buffer[i] = random(min, max);
+        buffer[0] = max;
+        buffer[buffer.length - 1] = min;
+        check(buffer.subarray(1, buffer.length - 1));
+        shouldBe(buffer[0], max);
+        shouldBe(buffer[buffer.length - 1], min);
+    }
+}
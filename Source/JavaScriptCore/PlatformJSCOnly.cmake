@@ -22,3 +22,7 @@ if (USE_LIBBACKTRACE)
         LIBBACKTRACE::LIBBACKTRACE
     )
 endif ()
+
+if (DEVELOPER_MODE AND CMAKE_SYSTEM_NAME MATCHES "Linux")
+    add_subdirectory(testmem)
+endif ()
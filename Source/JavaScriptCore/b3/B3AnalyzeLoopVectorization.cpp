@@ -0,0 +1,374 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */
+
+#include "config.h"
+#include "B3AnalyzeLoopVectorization.h"
+
+#if ENABLE(B3_JIT)
+
+#include "B3BasicBlockInlines.h"
+#include "B3MemoryValueInlines.h"
+#include "B3NaturalLoops.h"
+#include "B3PhaseScope.h"
+#include "B3PhiChildren.h"
+#include "B3ProcedureInlines.h"
+#include "B3ValueInlines.h"
+#include <wtf/HashSet.h>
+
+namespace JSC { namespace B3 {
+
+namespace {
+
+class AnalyzeLoopVectorization {
+public:
+    AnalyzeLoopVectorization(Procedure& proc)
+        : m_proc(proc)
+        , m_phiChildren(proc)
+    {
+    }
+
+    unsigned run()
+    {
+        NaturalLoops& loops = m_proc.naturalLoops();
+        if (!loops.numLoops())
+            return 0;
+
+        m_proc.resetValueOwners();
+
+        unsigned numCandidates = 0;
+        for (unsigned loopIndex = 0; loopIndex < loops.numLoops(); ++loopIndex) {
+            const NaturalLoop& loop = loops.loop(loopIndex);
+            if (!loop.isInnerMostLoop())
+                continue;
+            ASCIILiteral reason = analyze(loop);
+            if (reason.isNull()) {
+                numCandidates++;
+                dataLogLn("Vectorizable loop ", loop, ": induction variable = ", *m_inductionVariable, ", element accesses = ", m_accesses.size(),
+                    ", bounds checks to hoist = ", m_numHoistableChecks, ", base pairs needing a disjointness check = ", m_numDisjointnessChecks);
+                continue;
+            }
+            dataLogLn("Non-vectorizable loop ", loop, ": ", reason);
+        }
+        return numCandidates;
+    }
+
+private:
+    struct Access {
+        MemoryValue* memory;
+        Value* base;
+        Value* index;
+    };
+
+    bool isLoopInvariant(Value* value) const
+    {
+        return !m_loop->contains(value->owner);
+    }
+
+    static Value* stripIndexExtension(Value* value)
+    {
+        if (value->opcode() == ZExt32 || value->opcode() == SExt32)
+            return value->child(0);
+        return value;
+    }
+
+    bool isInductionVariable(Value* value) const
+    {
+        value = stripIndexExtension(value);
+        return value == m_inductionVariable || value == m_increment;
+    }
+
+    // Matches index * elementSize, where index is the induction variable (possibly extended to 64 bits).
+    // Returns the unextended index so that accesses at i and i + 1 can be told apart.
+    Value* scaledInductionVariable(Value* value, size_t elementSize) const
+    {
+        auto index = [&] (Value* value) -> Value* {
+            return isInductionVariable(value) ? stripIndexExtension(value) : nullptr;
+        };
+        if (elementSize == 1)
+            return index(value);
+        switch (value->opcode()) {
+        case Shl:
+            if (value->child(1)->hasInt32()
+                && static_cast<uint64_t>(value->child(1)->asInt32()) < 64
+                && (static_cast<uint64_t>(1) << value->child(1)->asInt32()) == elementSize)
+                return index(value->child(0));
+            return nullptr;
+        case Mul:
+            for (unsigned i = 0; i < 2; ++i) {
+                if (value->child(i)->isInt(elementSize))
+                    return index(value->child(1 - i));
+            }
+            return nullptr;
+        default:
+            return nullptr;
+        }
+    }
+
+    // Matches base + index * elementSize with a loop-invariant base.
+    std::optional<Access> unitStrideAccess(MemoryValue* memory) const
+    {
+        Value* address = memory->lastChild();
+        if (address->opcode() != Add)
+            return std::nullopt;
+        for (unsigned i = 0; i < 2; ++i) {
+            Value* base = address->child(i);
+            if (!isLoopInvariant(base))
+                continue;
+            if (Value* index = scaledInductionVariable(address->child(1 - i), memory->accessByteSize()))
+                return Access { memory, base, index };
+        }
+        return std::nullopt;
+    }
+
+    // A side exit that compares the induction variable against a loop-invariant bound, such as the
+    // bounds check the FTL emits for every typed array access, is monotonic in the induction variable.
+    // It can be replaced by one check of the first and last index in the pre-header, falling back to
+    // the scalar loop when that fails.
+    bool isHoistableCheck(Value* check) const
+    {
+        Value* condition = check->child(0);
+        switch (condition->opcode()) {
+        case LessThan:
+        case LessEqual:
+        case GreaterThan:
+        case GreaterEqual:
+        case Below:
+        case BelowEqual:
+        case Above:
+        case AboveEqual:
+            break;
+        default:
+            return false;
+        }
+        for (unsigned i = 0; i < 2; ++i) {
+            if (isInductionVariable(condition->child(i)) && isLoopInvariant(condition->child(1 - i)))
+                return true;
+        }
+        return false;
+    }
+
+    bool findInductionVariable()
+    {
+        m_inductionVariable = nullptr;
+        m_increment = nullptr;
+        for (Value* value : *m_loop->header()) {
+            if (value->opcode() != Phi)
+                continue;
+            if (m_inductionVariable)
+                return false;
+            if (value->type() != Int32 && value->type() != Int64)
+                return false;
+
+            auto upsilons = m_phiChildren.at(value);
+            if (upsilons.size() != 2)
+                return false;
+            for (Value* upsilon : upsilons) {
+                if (isLoopInvariant(upsilon))
+                    continue;
+                Value* increment = upsilon->child(0);
+                if (increment->opcode() != Add && increment->opcode() != CheckAdd)
+                    return false;
+                bool isUnitStep = (increment->child(0) == value && increment->child(1)->isInt(1))
+                    || (increment->child(1) == value && increment->child(0)->isInt(1));
+                if (!isUnitStep)
+                    return false;
+                m_increment = increment;
+            }
+            if (!m_increment)
+                return false;
+            m_inductionVariable = value;
+        }
+        return !!m_inductionVariable;
+    }
+
+    bool hasComputableTripCount()
+    {
+        Value* exitCondition = nullptr;
+        for (unsigned i = 0; i < m_loop->size(); ++i) {
+            BasicBlock* block = m_loop->at(i);
+            for (BasicBlock* successor : block->successorBlocks()) {
+                if (m_loop->contains(successor))
+                    continue;
+                if (exitCondition || block->last()->opcode() != Branch)
+                    return false;
+                exitCondition = block->last()->child(0);
+            }
+        }
+        if (!exitCondition)
+            return false;
+
+        switch (exitCondition->opcode()) {
+        case LessThan:
+        case LessEqual:
+        case GreaterThan:
+        case GreaterEqual:
+        case Below:
+        case BelowEqual:
+        case Above:
+        case AboveEqual:
+        case NotEqual:
+        case Equal:
+            break;
+        default:
+            return false;
+        }
+        for (unsigned i = 0; i < 2; ++i) {
+            if (isInductionVariable(exitCondition->child(i)) && isLoopInvariant(exitCondition->child(1 - i)))
+                return true;
+        }
+        return false;
+    }
+
+    ASCIILiteral analyze(const NaturalLoop& loop)
+    {
+        m_loop = &loop;
+        m_accesses.shrink(0);
+        m_numHoistableChecks = 0;
+        m_numDisjointnessChecks = 0;
+
+        // FIXME: Allow if-converted bodies with more blocks once we can emit masked stores.
+        if (loop.size() > 2)
+            return "loop has more than two blocks"_s;
+        if (!findInductionVariable())
+            return "no unit-stride integer induction variable"_s;
+        if (!hasComputableTripCount())
+            return "trip count is not computable on entry"_s;
+
+        for (unsigned i = 0; i < loop.size(); ++i) {
+            for (Value* value : *loop.at(i)) {
+                if (value->type().isVector())
+                    return "loop already uses SIMD values"_s;
+                if (value->type().isTuple())
+                    return "loop produces tuples"_s;
+
+                switch (value->opcode()) {
+                case Load:
+                case Store: {
+                    MemoryValue* memory = value->as<MemoryValue>();
+                    if (memory->isExotic())
+                        return "loop contains fenced or atomic memory accesses"_s;
+                    Type type = memory->accessType();
+                    if (type != Int32 && type != Float && type != Double)
+                        return "loop accesses elements of a type without a SIMD lane form"_s;
+                    auto access = unitStrideAccess(memory);
+                    if (!access)
+                        return "loop contains a memory access that is not unit-stride in the induction variable"_s;
+                    m_accesses.append(*access);
+                    break;
+                }
+                case Check:
+                    if (!isHoistableCheck(value))
+                        return "loop contains side exits that cannot be hoisted out of the loop"_s;
+                    m_numHoistableChecks++;
+                    break;
+                case CheckSub:
+                case CheckMul:
+                    return "loop contains side exits that cannot be hoisted out of the loop"_s;
+                case CheckAdd:
+                    if (value != m_increment)
+                        return "loop contains side exits that cannot be hoisted out of the loop"_s;
+                    break;
+                default:
+                    if (value->effects().mustExecute() && !value->effects().terminal && value->opcode() != Upsilon)
+                        return "loop contains calls or effects that cannot be widened"_s;
+                    if (B3::isLoad(value->opcode()) || B3::isStore(value->opcode()))
+                        return "loop contains sub-word memory accesses"_s;
+                    break;
+                }
+
+                if (value->opcode() == Phi && value != m_inductionVariable)
+                    return "loop carries a value other than the induction variable"_s;
+                if (value->opcode() == Upsilon && isLoopInvariant(value->as<UpsilonValue>()->phi())) {
+                    Value* child = value->child(0);
+                    if (!isLoopInvariant(child) && !isInductionVariable(child))
+                        return "a value computed in the loop is live after it"_s;
+                }
+            }
+        }
+
+        // Stores may only alias accesses to exactly the same element. Accesses off a different base are
+        // allowed even when their heap ranges overlap, as they do for all FTL typed array accesses: the
+        // vector loop is then guarded by a pre-header check that the two base ranges are disjoint.
+        UncheckedKeyHashSet<std::pair<Value*, Value*>> basePairs;
+        for (const Access& store : m_accesses) {
+            if (!store.memory->isStore())
+                continue;
+            for (const Access& other : m_accesses) {
+                if (&other == &store)
+                    continue;
+                if (!store.memory->range().overlaps(other.memory->range()))
+                    continue;
+                if (other.base != store.base) {
+                    auto [first, second] = std::minmax(store.base, other.base);
+                    if (basePairs.add({ first, second }).isNewEntry)
+                        m_numDisjointnessChecks++;
+                    continue;
+                }
+                if (other.index == store.index && other.memory->offset() == store.memory->offset())
+                    continue;
+                return "a store may alias another access in a different iteration"_s;
+            }
+        }
+
+        // Everything computed in the body other than the induction variable must die in the body.
+        for (BasicBlock* block : m_proc) {
+            if (m_loop->contains(block))
+                continue;
+            for (Value* value : *block) {
+                for (Value* child : value->children()) {
+                    if (isLoopInvariant(child) || isInductionVariable(child))
+                        continue;
+                    return "a value computed in the loop is live after it"_s;
+                }
+            }
+        }
+
+        if (m_accesses.isEmpty())
+            return "loop does not access memory"_s;
+        return { };
+    }
+
+    Procedure& m_proc;
+    PhiChildren m_phiChildren;
+    const NaturalLoop* m_loop { nullptr };
+    Value* m_inductionVariable { nullptr };
+    Value* m_increment { nullptr };
+    Vector<Access> m_accesses;
+    unsigned m_numHoistableChecks { 0 };
+    unsigned m_numDisjointnessChecks { 0 };
+};
+
+} // anonymous namespace
+
+unsigned analyzeLoopVectorization(Procedure& proc)
+{
+    PhaseScope phaseScope(proc, "analyzeLoopVectorization"_s);
+    AnalyzeLoopVectorization analyzeLoopVectorization(proc);
+    return analyzeLoopVectorization.run();
+}
+
+} } // namespace JSC::B3
+
+#endif // ENABLE(B3_JIT)
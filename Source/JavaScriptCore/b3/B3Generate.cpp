@@ -29,6 +29,7 @@
 #if ENABLE(B3_JIT)
 
 #include "AirGenerate.h"
+#include "B3AnalyzeLoopVectorization.h"
 #include "B3CanonicalizePrePostIncrements.h"
 #include "B3Common.h"
 #include "B3DuplicateTails.h"
@@ -58,6 +59,8 @@ void prepareForGeneration(Procedure& procedure)
     CompilerTimingScope timingScope("Total B3+Air"_s, "prepareForGeneration"_s);
 
     generateToAir(procedure);
+    if (procedure.exceededCompileTimeBudget()) [[unlikely]]
+        return;
     Air::prepareForGeneration(procedure.code());
 }
 
@@ -86,6 +89,8 @@ void generateToAir(Procedure& procedure)
         reduceStrength(procedure);
         if (Options::useB3HoistLoopInvariantValues())
             hoistLoopInvariantValues(procedure);
+        if (Options::logB3LoopVectorizationCandidates())
+            analyzeLoopVectorization(procedure);
         if (eliminateCommonSubexpressions(procedure))
             eliminateCommonSubexpressions(procedure);
         eliminateDeadCode(procedure);
@@ -101,6 +106,9 @@ void generateToAir(Procedure& procedure)
         reduceStrength(procedure);
     }
 
+    if (procedure.exceededCompileTimeBudget()) [[unlikely]]
+        return;
+
     // This puts the IR in quirks mode.
     lowerMacros(procedure);
 
@@ -128,6 +136,9 @@ void generateToAir(Procedure& procedure)
 
     if (shouldValidateIR())
         validate(procedure);
+
+    if (procedure.exceededCompileTimeBudget()) [[unlikely]]
+        return;
     
     // If we're doing super verbose dumping, the phase scope of any phase will already do a dump.
     // Note that lowerToAir() acts like a phase in this regard.
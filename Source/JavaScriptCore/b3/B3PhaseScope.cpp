@@ -55,6 +55,7 @@ PhaseScope::~PhaseScope()
     m_procedure.setLastPhaseName(m_name);
     if (shouldValidateIRAtEachPhase())
         validate(m_procedure, m_dumpBefore.data());
+    m_procedure.checkCompileTimeBudget(m_name);
 }
 
 } } // namespace JSC::B3
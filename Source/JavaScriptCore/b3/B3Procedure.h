@@ -211,6 +211,26 @@ public:
 
     const char* lastPhaseName() const { return m_lastPhaseName; }
 
+    // Lets the client give up on a compilation that is taking too long. The check runs as each B3 and Air
+    // phase ends and is passed that phase's name. Once it returns true, prepareForGeneration() stops at its
+    // next checkpoint and the procedure must not be generated. Air stops checking when register allocation
+    // starts, since from there on finishing the compile is cheaper than throwing it away.
+    template<typename Callback>
+    void setCompileTimeBudgetCheck(Callback&& callback)
+    {
+        m_compileTimeBudgetCheck = createSharedTask<bool(ASCIILiteral)>(std::forward<Callback>(callback));
+    }
+
+    void stopCheckingCompileTimeBudget() { m_compileTimeBudgetCheck = nullptr; }
+
+    void checkCompileTimeBudget(ASCIILiteral phaseName)
+    {
+        if (m_compileTimeBudgetCheck && !m_exceededCompileTimeBudget) [[unlikely]]
+            m_exceededCompileTimeBudget = m_compileTimeBudgetCheck->run(phaseName);
+    }
+
+    bool exceededCompileTimeBudget() const { return m_exceededCompileTimeBudget; }
+
     // Allocates a slab of memory that will be kept alive by anyone who keeps the resulting code
     // alive. Great for compiler-generated data sections, like switch jump tables and constant pools.
     // This returns memory that has been zero-initialized.
@@ -323,6 +343,7 @@ private:
     std::unique_ptr<OpaqueByproducts> m_byproducts;
     std::unique_ptr<Air::Code> m_code;
     RefPtr<SharedTask<void(PrintStream&, Origin)>> m_originPrinter;
+    RefPtr<SharedTask<bool(ASCIILiteral)>> m_compileTimeBudgetCheck;
     const void* m_frontendData;
     PCToOriginMap m_pcToOriginMap;
     unsigned m_numEntrypoints { 1 };
@@ -332,6 +353,7 @@ private:
     bool m_needsPCToOriginMap { false };
     bool m_shouldDumpIR { false };
     bool m_usesSIMD { false };
+    bool m_exceededCompileTimeBudget { false };
 };
     
 } } // namespace JSC::B3
@@ -1720,6 +1720,7 @@ private:
         tmpData.liveRange = LiveRange::subtract(tmpData.liveRange, holeRange);
         tmpData.splitMetadataIndex = m_splitMetadata.size();
         setStageAndEnqueue(tmp, tmpData, Stage::TryAllocate);
+        m_stats[bank].numSplitTmps++;
 
         SplitMetadata metadata;
         metadata.originalTmp = tmp;
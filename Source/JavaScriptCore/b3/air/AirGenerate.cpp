@@ -75,6 +75,8 @@ void prepareForGeneration(Code& code)
         validate(code);
 
     if (!code.optLevel()) {
+        code.proc().stopCheckingCompileTimeBudget();
+
         lowerMacros(code);
 
         // FIXME: The name of this phase doesn't make much sense in O0 since we do this before
@@ -112,6 +114,10 @@ void prepareForGeneration(Code& code)
 
     eliminateDeadCode(code);
 
+    if (code.proc().exceededCompileTimeBudget()) [[unlikely]]
+        return;
+    code.proc().stopCheckingCompileTimeBudget();
+
     auto useLinearScan = [](Code& code) -> bool {
         if (code.usesSIMD())
             return false;
@@ -141,14 +147,19 @@ void prepareForGeneration(Code& code)
 
         // Register allocation for all the Tmps that do not have a corresponding machine
         // register. After this phase, every Tmp has a reg.
+        MonotonicTime before;
+        if (Options::logAirRegisterPressure()) [[unlikely]]
+            before = MonotonicTime::now();
         if (Options::airUseGreedyRegAlloc())
             allocateRegistersByGreedy(code);
         else
             allocateRegistersByGraphColoring(code);
 
         if (Options::logAirRegisterPressure()) {
+            Seconds allocationTime = MonotonicTime::now() - before;
             dataLog("Register pressure after register allocation:\n");
             logRegisterPressure(code);
+            dataLogLn("Register allocation (", Options::airUseGreedyRegAlloc() ? "greedy" : "graph coloring", ") took ", allocationTime.milliseconds(), " ms for ", code.numTmps(Bank::GP) + code.numTmps(Bank::FP), " tmps");
         }
 
         // This replaces uses of spill slots with registers or constants if possible. It
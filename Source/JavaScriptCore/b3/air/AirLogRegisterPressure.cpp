@@ -32,6 +32,7 @@
 #include "AirCode.h"
 #include "AirInstInlines.h"
 #include "AirRegLiveness.h"
+#include "AirStackSlot.h"
 
 namespace JSC { namespace B3 { namespace Air {
 
@@ -42,6 +43,10 @@ void logRegisterPressure(Code& code)
     
     RegLiveness liveness(code);
 
+    unsigned maxPressure[numBanks] = { 0, 0 };
+    unsigned numSpillLoads = 0;
+    unsigned numSpillStores = 0;
+
     for (BasicBlock* block : code) {
         RegLiveness::LocalCalc localCalc(liveness, block);
 
@@ -63,6 +68,24 @@ void logRegisterPressure(Code& code)
                     set.add(reg, width);
                 });
 
+            unsigned pressure[numBanks] = { 0, 0 };
+            set.forEach([&] (Reg reg) {
+                pressure[reg.isGPR() ? GP : FP]++;
+            });
+            forEachBank([&] (Bank bank) {
+                maxPressure[bank] = std::max(maxPressure[bank], pressure[bank]);
+            });
+
+            inst.forEachArg(
+                [&] (Arg& arg, Arg::Role role, Bank, Width) {
+                    if (!arg.isStack() || arg.stackSlot()->kind() != StackSlotKind::Spill)
+                        return;
+                    if (Arg::isAnyUse(role))
+                        numSpillLoads++;
+                    if (Arg::isAnyDef(role))
+                        numSpillStores++;
+                });
+
             StringPrintStream instOut;
             StringPrintStream lineOut;
             lineOut.print("   ");
@@ -96,6 +119,15 @@ void logRegisterPressure(Code& code)
         
         block->dumpFooter(WTF::dataFile());
     }
+
+    unsigned numSpillSlots = 0;
+    for (StackSlot* slot : code.stackSlots()) {
+        if (slot->kind() == StackSlotKind::Spill)
+            numSpillSlots++;
+    }
+
+    dataLogLn("Max register pressure: GP = ", maxPressure[GP], ", FP = ", maxPressure[FP]);
+    dataLogLn("Spills: slots = ", numSpillSlots, ", loads = ", numSpillLoads, ", stores = ", numSpillStores);
 }
 
 } } } // namespace JSC::B3::Air
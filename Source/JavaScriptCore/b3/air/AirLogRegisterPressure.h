@@ -31,7 +31,8 @@ namespace JSC { namespace B3 { namespace Air {
 
 class Code;
 
-// Dumps the registers that are used at each instruction.
+// Dumps the registers that are used at each instruction, followed by the peak per-bank pressure
+// and a summary of the spill code that register allocation left behind.
 void logRegisterPressure(Code&);
 
 } } } // namespace JSC::B3::Air
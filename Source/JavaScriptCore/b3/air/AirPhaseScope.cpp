@@ -31,6 +31,7 @@
 #include "AirCode.h"
 #include "AirValidate.h"
 #include "B3Common.h"
+#include "B3Procedure.h"
 #include <wtf/StringPrintStream.h>
 
 namespace JSC { namespace B3 { namespace Air {
@@ -54,6 +55,7 @@ PhaseScope::~PhaseScope()
     m_code.setLastPhaseName(m_name);
     if (shouldValidateIRAtEachPhase())
         validate(m_code, m_dumpBefore.data());
+    m_code.proc().checkCompileTimeBudget(m_name);
 }
 
 } } } // namespace JSC::B3::Air
@@ -887,6 +887,8 @@ void run(const TestConfig* config)
     RUN(testLoopWithMultipleHeaderEdges());
 
     RUN(testInfiniteLoopDoesntCauseBadHoisting());
+    RUN(testAnalyzeLoopVectorizationTypedArrays());
+    RUN(testAnalyzeLoopVectorizationLoopCarriedStore());
 
     RUN(testFloatMaxMin());
     RUN(testDoubleMaxMin());
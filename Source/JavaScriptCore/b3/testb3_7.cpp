@@ -1678,6 +1678,101 @@ void testInfiniteLoopDoesntCauseBadHoisting()
     invoke<void>(*code, static_cast<intptr_t>(55)); // Shouldn't crash dereferncing 55.
 }
 
+// Builds the B3 the FTL emits for "for (i = 0; i < n; ++i) a[storeOffset + i] = b[i] * 3 + d[i]" over
+// Float64Arrays of the given length: every access shares one heap range and is bounds checked.
+static void buildTypedArrayMultiplyAddLoop(Procedure& proc, bool storeToFirstSource, int32_t storeOffset)
+{
+    BasicBlock* root = proc.addBlock();
+    BasicBlock* header = proc.addBlock();
+    BasicBlock* body = proc.addBlock();
+    BasicBlock* exit = proc.addBlock();
+    auto arguments = cCallArgumentValues<double*, double*, double*, int32_t, int32_t>(proc, root);
+    Value* a = storeToFirstSource ? arguments[1] : arguments[0];
+    Value* b = arguments[1];
+    Value* d = arguments[2];
+    Value* n = arguments[3];
+    Value* length = arguments[4];
+    HeapRange typedArrayProperties(42);
+
+    UpsilonValue* initial = root->appendNew<UpsilonValue>(proc, Origin(), root->appendNew<Const32Value>(proc, Origin(), 0));
+    root->appendNewControlValue(proc, Jump, Origin(), FrequentedBlock(header));
+
+    Value* i = header->appendNew<Value>(proc, Phi, Int32, Origin());
+    initial->setPhi(i);
+    header->appendNewControlValue(proc, Branch, Origin(),
+        header->appendNew<Value>(proc, LessThan, Origin(), i, n),
+        FrequentedBlock(body), FrequentedBlock(exit));
+
+    auto checkInBounds = [&] (Value* index) {
+        CheckValue* check = body->appendNew<CheckValue>(proc, Check, Origin(),
+            body->appendNew<Value>(proc, AboveEqual, Origin(), index, length));
+        check->setGenerator(
+            [&] (CCallHelpers& jit, const StackmapGenerationParams&) {
+                AllowMacroScratchRegisterUsage allowScratch(jit);
+                jit.move(CCallHelpers::TrustedImm32(42), GPRInfo::returnValueGPR);
+                jit.emitFunctionEpilogue();
+                jit.ret();
+            });
+    };
+    auto element = [&] (Value* base, Value* index) {
+        return body->appendNew<Value>(proc, Add, Origin(), base,
+            body->appendNew<Value>(proc, Shl, Origin(),
+                body->appendNew<Value>(proc, ZExt32, Origin(), index),
+                body->appendNew<Const32Value>(proc, Origin(), 3)));
+    };
+
+    Value* increment = body->appendNew<Value>(proc, Add, Origin(), i, body->appendNew<Const32Value>(proc, Origin(), 1));
+    Value* storeIndex = storeOffset ? increment : i;
+    checkInBounds(i);
+    MemoryValue* loadB = body->appendNew<MemoryValue>(proc, Load, Double, Origin(), element(b, i));
+    loadB->setRange(typedArrayProperties);
+    MemoryValue* loadD = body->appendNew<MemoryValue>(proc, Load, Double, Origin(), element(d, i));
+    loadD->setRange(typedArrayProperties);
+    Value* result = body->appendNew<Value>(proc, Add, Origin(),
+        body->appendNew<Value>(proc, Mul, Origin(), loadB, body->appendNew<ConstDoubleValue>(proc, Origin(), 3)),
+        loadD);
+    if (storeOffset)
+        checkInBounds(storeIndex);
+    MemoryValue* store = body->appendNew<MemoryValue>(proc, Store, Origin(), result, element(a, storeIndex));
+    store->setRange(typedArrayProperties);
+    body->appendNew<UpsilonValue>(proc, Origin(), increment, i);
+    body->appendNewControlValue(proc, Jump, Origin(), FrequentedBlock(header));
+
+    exit->appendNewControlValue(proc, Return, Origin(), exit->appendNew<Const32Value>(proc, Origin(), 0));
+}
+
+void testAnalyzeLoopVectorizationTypedArrays()
+{
+    if constexpr (is32Bit())
+        return;
+
+    Procedure proc;
+    buildTypedArrayMultiplyAddLoop(proc, false, 0);
+    // The bounds checks compare the induction variable against an invariant length, and a, b and d
+    // only need a runtime disjointness check, so this is a candidate.
+    CHECK_EQ(analyzeLoopVectorization(proc), 1u);
+
+    double a[8] { };
+    double b[8] { 1, 2, 3, 4, 5, 6, 7, 8 };
+    double d[8] { 8, 7, 6, 5, 4, 3, 2, 1 };
+    auto code = compileProc(proc);
+    CHECK_EQ(invoke<int>(*code, a, b, d, 8, 8), 0);
+    for (unsigned i = 0; i < 8; ++i)
+        CHECK_EQ(a[i], b[i] * 3 + d[i]);
+    CHECK_EQ(invoke<int>(*code, a, b, d, 8, 4), 42);
+}
+
+void testAnalyzeLoopVectorizationLoopCarriedStore()
+{
+    if constexpr (is32Bit())
+        return;
+
+    // b[i + 1] = b[i] * 3 + d[i] feeds each store into the next iteration's load.
+    Procedure proc;
+    buildTypedArrayMultiplyAddLoop(proc, true, 1);
+    CHECK_EQ(analyzeLoopVectorization(proc), 0u);
+}
+
 static void testSimpleTuplePair(unsigned first, int64_t second)
 {
     Procedure proc;
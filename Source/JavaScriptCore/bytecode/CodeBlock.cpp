@@ -2758,6 +2758,7 @@ void CodeBlock::setOptimizationThresholdBasedOnCompilationResult(CompilationResu
         optimizeNextInvocation();
         return;
     case CompilationFailed:
+    case CompilationOverBudget:
         dontOptimizeAnytimeSoon();
         return;
     case CompilationDeferred:
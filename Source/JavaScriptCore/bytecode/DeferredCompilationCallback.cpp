@@ -37,6 +37,7 @@ void DeferredCompilationCallback::compilationDidComplete(CodeBlock*, CodeBlock*,
 
     switch (result) {
     case CompilationFailed:
+    case CompilationOverBudget:
     case CompilationInvalidated:
     case CompilationSuccessful:
         break;
@@ -340,6 +340,10 @@ void JITCode::setOptimizationThresholdBasedOnCompilationResult(
         dontOptimizeAnytimeSoon(codeBlock);
         codeBlock->baselineVersion()->m_didFailFTLCompilation = true;
         return;
+    case CompilationOverBudget:
+        // Stay in the DFG for as long as this code block lives, but let a future DFG code block try again.
+        dontOptimizeAnytimeSoon(codeBlock);
+        return;
     case CompilationDeferred:
         optimizeAfterWarmUp(codeBlock);
         return;
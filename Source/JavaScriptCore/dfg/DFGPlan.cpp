@@ -183,6 +183,24 @@ void Plan::cancel()
     m_callback = nullptr;
 }
 
+bool Plan::exceededCompileTimeBudget(ASCIILiteral phaseName)
+{
+    if (!m_compileTimeBudgetStart) [[likely]]
+        return false;
+
+    Seconds elapsed = MonotonicTime::now() - m_compileTimeBudgetStart;
+    if (elapsed.milliseconds() <= Options::ftlCompileTimeBudgetMs())
+        return false;
+
+    // The plan finalizes as CompilationOverBudget, which makes the DFG code block back off from tiering up
+    // (see setOptimizationThresholdBasedOnCompilationResult) without marking FTL compilation as failed.
+    m_exceededCompileTimeBudget = true;
+    recordCompileTimeBudgetOverrun("FTL"_s, phaseName);
+    dataLogLnIf(reportCompileTimes() || Options::logPhaseTimes(),
+        "FTL compilation of ", *m_codeBlock, " exceeded its ", Options::ftlCompileTimeBudgetMs(), " ms budget after ", phaseName, " (", elapsed.milliseconds(), " ms), leaving it in the DFG.");
+    return true;
+}
+
 Plan::CompilationPath Plan::compileInThreadImpl()
 {
     {
@@ -195,6 +213,9 @@ Plan::CompilationPath Plan::compileInThreadImpl()
         "\n",
         "Compiler must handle OSR entry from ", m_osrEntryBytecodeIndex, " with values: ", m_mustHandleValues, "\n");
 
+    if (isFTL() && Options::ftlCompileTimeBudgetMs()) [[unlikely]]
+        m_compileTimeBudgetStart = MonotonicTime::now();
+
     Graph dfg(*m_vm, *this);
 
     {
@@ -217,6 +238,10 @@ Plan::CompilationPath Plan::compileInThreadImpl()
         }                                                        \
         dfg.nextPhase();                                         \
         changed |= phase(dfg);                                   \
+        if (exceededCompileTimeBudget(ASCIILiteral::fromLiteralUnsafe(#phase))) { \
+            m_finalizer = makeUnique<FailedFinalizer>(*this);    \
+            return FailPath;                                     \
+        }                                                        \
     } while (false);                                             \
 
     
@@ -473,6 +498,15 @@ Plan::CompilationPath Plan::compileInThreadImpl()
         FTL::State state(dfg);
         FTL::lowerDFGToB3(state);
 
+        // Lowering and B3/Air are where big functions spend most of their compile time, so keep checking
+        // the budget there: after lowering, and as each B3 and Air phase ends.
+        if (exceededCompileTimeBudget("lowerDFGToB3"_s)) [[unlikely]] {
+            m_finalizer = makeUnique<FailedFinalizer>(*this);
+            return FailPath;
+        }
+        if (m_compileTimeBudgetStart) [[unlikely]]
+            state.proc->setCompileTimeBudgetCheck([this] (ASCIILiteral phaseName) { return exceededCompileTimeBudget(phaseName); });
+
         if (computeCompileTimes()) [[unlikely]]
             m_timeBeforeFTL = MonotonicTime::now();
         
@@ -484,6 +518,11 @@ Plan::CompilationPath Plan::compileInThreadImpl()
         FTL::compile(state, safepointResult);
         if (safepointResult.didGetCancelled())
             return CancelPath;
+
+        if (state.proc->exceededCompileTimeBudget()) [[unlikely]] {
+            m_finalizer = makeUnique<FailedFinalizer>(*this);
+            return FailPath;
+        }
         
         if (Options::b3AlwaysFailsBeforeLink()) [[unlikely]] {
             FTL::fail(state);
@@ -575,6 +614,10 @@ CompilationResult Plan::finalize()
 
     CompilationResult result = [&] {
         if (m_finalizer->isFailed()) {
+            if (m_exceededCompileTimeBudget) [[unlikely]] {
+                CODEBLOCK_LOG_EVENT(m_codeBlock, "dfgFinalize", ("over budget"));
+                return CompilationOverBudget;
+            }
             CODEBLOCK_LOG_EVENT(m_codeBlock, "dfgFinalize", ("failed"));
             return CompilationFailed;
         }
@@ -111,6 +111,7 @@ private:
     
     bool isStillValidCodeBlock();
     bool reallyAdd(CommonData*);
+    bool exceededCompileTimeBudget(ASCIILiteral phaseName);
 
     // These can be raw pointers because we visit them during every GC in checkLivenessAndVisitChildren.
     CodeBlock* m_profiledDFGCodeBlock;
@@ -138,6 +139,9 @@ private:
     Vector<BytecodeIndex> m_tierUpAndOSREnterBytecodes;
 
     RefPtr<DeferredCompilationCallback> m_callback;
+
+    MonotonicTime m_compileTimeBudgetStart;
+    bool m_exceededCompileTimeBudget { false };
 };
 
 #endif // ENABLE(DFG_JIT)
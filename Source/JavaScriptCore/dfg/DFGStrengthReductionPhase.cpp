@@ -1484,7 +1484,8 @@ private:
                     Edge argument = m_graph.varArgChild(m_node, 2 + index);
                     switch (type.kind) {
                     case Wasm::TypeKind::I32: {
-                        if (!argument->shouldSpeculateInt32())
+                        // Non-int32 numbers are still fine: Wasm applies ToInt32 at the boundary, which we can do inline.
+                        if (!argument->shouldSpeculateNumber())
                             success = false;
                         break;
                     }
@@ -1564,8 +1565,15 @@ private:
                     Node* argumentNode = argument.node();
                     switch (type.kind) {
                     case Wasm::TypeKind::I32: {
-                        m_insertionSet.insertCheck(checkIndex, m_node->origin, Edge(argumentNode, Int32Use));
-                        m_graph.varArgChild(m_node, 2 + index) = Edge(argumentNode, KnownInt32Use);
+                        if (argument->shouldSpeculateInt32()) {
+                            m_insertionSet.insertCheck(checkIndex, m_node->origin, Edge(argumentNode, Int32Use));
+                            m_graph.varArgChild(m_node, 2 + index) = Edge(argumentNode, KnownInt32Use);
+                            break;
+                        }
+                        UseKind useKind = argument->shouldSpeculateDoubleReal() ? RealNumberUse : NumberUse;
+                        Node* doubleNode = m_insertionSet.insertNode(checkIndex, SpecBytecodeDouble, DoubleRep, m_node->origin, Edge(argumentNode, useKind));
+                        Node* result = m_insertionSet.insertNode(checkIndex, SpecInt32Only, ValueToInt32, m_node->origin, Edge(doubleNode, DoubleRepUse));
+                        m_graph.varArgChild(m_node, 2 + index) = Edge(result, KnownInt32Use);
                         break;
                     }
                     case Wasm::TypeKind::I64: {
@@ -73,6 +73,7 @@ void ToFTLForOSREntryDeferredCompilationCallback::compilationDidComplete(
         break;
     }
     case CompilationFailed:
+    case CompilationOverBudget:
         jitCode->osrEntryRetry = 0;
         jitCode->abandonOSREntry = true;
         profiledDFGCodeBlock->jitCode()->dfg()->setOptimizationThresholdBasedOnCompilationResult(
@@ -72,6 +72,10 @@ void compile(State& state, Safepoint::Result& safepointResult)
     if (safepointResult.didGetCancelled())
         return;
     RELEASE_ASSERT(!state.graph.m_vm.heap.worldIsStopped());
+
+    // The plan fails the compilation; prepareForGeneration() stopped partway through.
+    if (state.proc->exceededCompileTimeBudget()) [[unlikely]]
+        return;
     
     if (state.allocationFailed)
         return;
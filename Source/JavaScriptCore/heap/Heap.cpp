@@ -2268,6 +2268,7 @@ void Heap::finalize()
         vm().jsonAtomStringCache.clear();
         vm().numericStrings.clearOnGarbageCollection();
         vm().stringReplaceCache.clear();
+        vm().ropeAppendBuffer = nullptr;
     }
     vm().keyAtomStringCache.clear();
     vm().stringSplitCache.clear();
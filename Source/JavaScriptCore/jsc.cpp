@@ -98,6 +98,7 @@
 #include <wtf/FileHandle.h>
 #include <wtf/FileSystem.h>
 #include <wtf/MainThread.h>
+#include <wtf/MemoryFootprint.h>
 #include <wtf/MemoryPressureHandler.h>
 #include <wtf/MonotonicTime.h>
 #include <wtf/SafeStrerror.h>
@@ -493,6 +494,7 @@ public:
     bool m_ignoreUncaughtExceptions { false };
     bool m_alwaysDumpUncaughtException { false };
     bool m_dumpMemoryFootprint { false };
+    bool m_dumpPasStats { false };
     bool m_dumpLinkBufferStats { false };
     bool m_dumpSamplingProfilerData { false };
     bool m_inspectable { false };
@@ -4006,6 +4008,7 @@ static void runInteractive(GlobalObject* globalObject)
     fprintf(stderr, "  --watchdog-exception-ok    Uncaught watchdog exceptions exit with success\n");
     fprintf(stderr, "  --dumpException            Dump uncaught exception text\n");
     fprintf(stderr, "  --footprint                Dump memory footprint after done executing\n");
+    fprintf(stderr, "  --pasStats                 Dump libpas telemetry after done executing\n");
     fprintf(stderr, "  --options                  Dumps all JSC VM options and exits\n");
     fprintf(stderr, "  --dumpOptions              Dumps all non-default JSC VM options before continuing\n");
     fprintf(stderr, "  --<jsc VM option>=<value>  Sets the specified JSC VM option\n");
@@ -4258,6 +4261,11 @@ void CommandLine::parseArguments(int argc, char** argv)
             continue;
         }
 
+        if (!strcmp(arg, "--pasStats")) {
+            m_dumpPasStats = true;
+            continue;
+        }
+
         if (!strcmp(arg, "--dumpLinkBufferStats")) {
             m_dumpLinkBufferStats = true;
             continue;
@@ -4579,6 +4587,9 @@ int jscmain(int argc, char** argv)
         printf("Memory Footprint:\n    Current Footprint: %" PRIu64 "\n    Peak Footprint: %" PRIu64 "\n", footprint.current, footprint.peak);
     }
 
+    if (mainCommandLine->m_dumpPasStats)
+        dumpMallocTelemetry();
+
 #if ENABLE(ASSEMBLER)
     if (mainCommandLine->m_dumpLinkBufferStats)
         LinkBuffer::dumpProfileStatistics();
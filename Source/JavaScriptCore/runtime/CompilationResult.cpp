@@ -36,6 +36,9 @@ void printInternal(PrintStream& out, CompilationResult result)
     case CompilationFailed:
         out.print("CompilationFailed");
         return;
+    case CompilationOverBudget:
+        out.print("CompilationOverBudget");
+        return;
     case CompilationInvalidated:
         out.print("CompilationInvalidated");
         return;
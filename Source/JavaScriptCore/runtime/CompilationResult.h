@@ -35,6 +35,12 @@ enum CompilationResult {
     // internal error and decided to bail out gracefully. Either way, this implies
     // that we shouldn't try to compile this code block again.
     CompilationFailed,
+
+    // The compiler gave up because it ran past its compile-time budget. Unlike
+    // CompilationFailed, this says nothing about whether a later compilation of
+    // this code block could succeed, so we should just wait a long time before
+    // trying again.
+    CompilationOverBudget,
     
     // The profiling assumptions that were fed into the compiler were invalidated
     // even before we finished compiling. This means we should try again: in such
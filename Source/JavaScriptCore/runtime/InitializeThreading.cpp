@@ -46,6 +46,7 @@
 #include "WasmFaultSignalHandler.h"
 #include "WasmThunks.h"
 #include <mutex>
+#include <wtf/OSAllocator.h>
 #include <wtf/Threading.h>
 #include <wtf/threads/Signals.h>
 
@@ -102,6 +103,11 @@ void initialize()
                 isARM64E_FPAC(); // Call this to initialize g_jscConfig.canUseFPAC.
 #endif
             }
+            // This comes after ExecutableAllocator::initialize() so that JIT memory stays on small pages.
+            if (Options::useTransparentHugePages()) {
+                OSAllocator::enableTransparentHugePages();
+                WTF::fastEnableTransparentHugePages();
+            }
             StructureAlignedMemoryAllocator::initializeStructureAddressSpace();
         }
         Options::finalize();
@@ -29,8 +29,16 @@
 #include <wtf/TZoneMallocInlines.h>
 #include <wtf/Vector.h>
 
+#ifdef U_HIDE_DRAFT_API
+#undef U_HIDE_DRAFT_API
+#endif
+#include <unicode/unumberformatter.h>
+#include <unicode/unumberrangeformatter.h>
+#define U_HIDE_DRAFT_API 1
+
 namespace JSC {
 
+WTF_MAKE_TZONE_ALLOCATED_IMPL(IntlSharedNumberFormatters);
 WTF_MAKE_TZONE_ALLOCATED_IMPL(IntlCache);
 
 UDateTimePatternGenerator* IntlCache::cacheSharedPatternGenerator(const CString& locale, UErrorCode& status)
@@ -68,4 +76,64 @@ Vector<UChar, 32> IntlCache::getFieldDisplayName(const CString& locale, UDateTim
     return buffer;
 }
 
+std::unique_ptr<UDateFormat, ICUDeleter<udat_close>> IntlCache::createDateFormat(const CString& locale, StringView timeZone, StringView pattern, UErrorCode& status)
+{
+    for (size_t index = 0; index < m_dateFormatCache.size(); ++index) {
+        auto& entry = m_dateFormatCache[index];
+        if (entry.locale != locale || entry.timeZone != timeZone || entry.pattern != pattern)
+            continue;
+        ++m_dateFormatCacheHits;
+        if (index) {
+            auto hit = WTFMove(entry);
+            m_dateFormatCache.removeAt(index);
+            m_dateFormatCache.insert(0, WTFMove(hit));
+        }
+        return std::unique_ptr<UDateFormat, ICUDeleter<udat_close>>(udat_clone(m_dateFormatCache[0].dateFormat.get(), &status));
+    }
+
+    ++m_dateFormatCacheMisses;
+    auto dateFormat = std::unique_ptr<UDateFormat, ICUDeleter<udat_close>>(udat_open(UDAT_PATTERN, UDAT_PATTERN, locale.data(), timeZone.upconvertedCharacters(), timeZone.length(), pattern.upconvertedCharacters(), pattern.length(), &status));
+    if (U_FAILURE(status))
+        return nullptr;
+    auto result = std::unique_ptr<UDateFormat, ICUDeleter<udat_close>>(udat_clone(dateFormat.get(), &status));
+    if (U_FAILURE(status))
+        return nullptr;
+
+    if (m_dateFormatCache.size() == dateFormatCacheCapacity)
+        m_dateFormatCache.removeLast();
+    m_dateFormatCache.insert(0, DateFormatCacheEntry { locale, timeZone.toString(), pattern.toString(), WTFMove(dateFormat) });
+    return result;
+}
+
+RefPtr<IntlSharedNumberFormatters> IntlCache::sharedNumberFormatters(const CString& locale, StringView skeleton, UErrorCode& status)
+{
+    for (size_t index = 0; index < m_numberFormatCache.size(); ++index) {
+        auto& entry = m_numberFormatCache[index];
+        if (entry.locale != locale || entry.skeleton != skeleton)
+            continue;
+        ++m_numberFormatCacheHits;
+        if (index) {
+            auto hit = WTFMove(entry);
+            m_numberFormatCache.removeAt(index);
+            m_numberFormatCache.insert(0, WTFMove(hit));
+        }
+        return m_numberFormatCache[0].formatters.ptr();
+    }
+
+    ++m_numberFormatCacheMisses;
+    auto upconverted = skeleton.upconvertedCharacters();
+    auto numberFormatter = std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter>(unumf_openForSkeletonAndLocale(upconverted.get(), skeleton.length(), locale.data(), &status));
+    if (U_FAILURE(status))
+        return nullptr;
+    auto numberRangeFormatter = std::unique_ptr<UNumberRangeFormatter, UNumberRangeFormatterDeleter>(unumrf_openForSkeletonWithCollapseAndIdentityFallback(upconverted.get(), skeleton.length(), UNUM_RANGE_COLLAPSE_AUTO, UNUM_IDENTITY_FALLBACK_APPROXIMATELY, locale.data(), nullptr, &status));
+    if (U_FAILURE(status))
+        return nullptr;
+
+    auto formatters = IntlSharedNumberFormatters::create(WTFMove(numberFormatter), WTFMove(numberRangeFormatter));
+    if (m_numberFormatCache.size() == numberFormatCacheCapacity)
+        m_numberFormatCache.removeLast();
+    m_numberFormatCache.insert(0, NumberFormatCacheEntry { locale, skeleton.toString(), formatters.copyRef() });
+    return formatters;
+}
+
 } // namespace JSC
@@ -25,14 +25,42 @@
 
 #pragma once
 
+#include "IntlNumberFormat.h"
+#include <unicode/udat.h>
 #include <unicode/udatpg.h>
 #include <wtf/Noncopyable.h>
+#include <wtf/RefCounted.h>
 #include <wtf/TZoneMalloc.h>
 #include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
 #include <wtf/unicode/icu/ICUHelpers.h>
 
 namespace JSC {
 
+// UNumberFormatters and UNumberRangeFormatters cannot be changed once opened, so every NumberFormat with the same
+// locale and skeleton can format with the same pair.
+class IntlSharedNumberFormatters : public RefCounted<IntlSharedNumberFormatters> {
+    WTF_MAKE_TZONE_ALLOCATED(IntlSharedNumberFormatters);
+public:
+    static Ref<IntlSharedNumberFormatters> create(std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter>&& numberFormatter, std::unique_ptr<UNumberRangeFormatter, UNumberRangeFormatterDeleter>&& numberRangeFormatter)
+    {
+        return adoptRef(*new IntlSharedNumberFormatters(WTFMove(numberFormatter), WTFMove(numberRangeFormatter)));
+    }
+
+    const UNumberFormatter* numberFormatter() const { return m_numberFormatter.get(); }
+    const UNumberRangeFormatter* numberRangeFormatter() const { return m_numberRangeFormatter.get(); }
+
+private:
+    IntlSharedNumberFormatters(std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter>&& numberFormatter, std::unique_ptr<UNumberRangeFormatter, UNumberRangeFormatterDeleter>&& numberRangeFormatter)
+        : m_numberFormatter(WTFMove(numberFormatter))
+        , m_numberRangeFormatter(WTFMove(numberRangeFormatter))
+    {
+    }
+
+    std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter> m_numberFormatter;
+    std::unique_ptr<UNumberRangeFormatter, UNumberRangeFormatterDeleter> m_numberRangeFormatter;
+};
+
 class IntlCache {
     WTF_MAKE_NONCOPYABLE(IntlCache);
     WTF_MAKE_TZONE_ALLOCATED(IntlCache);
@@ -42,6 +70,24 @@ public:
     Vector<UChar, 32> getBestDateTimePattern(const CString& locale, std::span<const UChar> skeleton, UErrorCode&);
     Vector<UChar, 32> getFieldDisplayName(const CString& locale, UDateTimePatternField, UDateTimePGDisplayWidth, UErrorCode&);
 
+    // Returns a new UDateFormat for the given pattern, cloned from a recently opened one when possible.
+    std::unique_ptr<UDateFormat, ICUDeleter<udat_close>> createDateFormat(const CString& locale, StringView timeZone, StringView pattern, UErrorCode&);
+
+    // Returns the formatters for the given skeleton, shared with other NumberFormats when possible.
+    RefPtr<IntlSharedNumberFormatters> sharedNumberFormatters(const CString& locale, StringView skeleton, UErrorCode&);
+
+    uint64_t dateFormatCacheHits() const { return m_dateFormatCacheHits; }
+    uint64_t dateFormatCacheMisses() const { return m_dateFormatCacheMisses; }
+    uint64_t numberFormatCacheHits() const { return m_numberFormatCacheHits; }
+    uint64_t numberFormatCacheMisses() const { return m_numberFormatCacheMisses; }
+    void clearCacheStatistics()
+    {
+        m_dateFormatCacheHits = 0;
+        m_dateFormatCacheMisses = 0;
+        m_numberFormatCacheHits = 0;
+        m_numberFormatCacheMisses = 0;
+    }
+
 private:
     UDateTimePatternGenerator* getSharedPatternGenerator(const CString& locale, UErrorCode& status)
     {
@@ -56,6 +102,32 @@ private:
 
     std::unique_ptr<UDateTimePatternGenerator, ICUDeleter<udatpg_close>> m_cachedDateTimePatternGenerator;
     CString m_cachedDateTimePatternGeneratorLocale;
+
+    // Opening a UDateFormat loads locale data and sets up a calendar, which costs far more than cloning an
+    // open one. Date.prototype.toLocaleString and friends create a DateTimeFormat per call, and pages tend to
+    // use only a few formats, so keep the most recently used ones around to clone from.
+    struct DateFormatCacheEntry {
+        CString locale;
+        String timeZone;
+        String pattern;
+        std::unique_ptr<UDateFormat, ICUDeleter<udat_close>> dateFormat;
+    };
+    static constexpr size_t dateFormatCacheCapacity = 8;
+    Vector<DateFormatCacheEntry, dateFormatCacheCapacity> m_dateFormatCache; // Most recently used first.
+    uint64_t m_dateFormatCacheHits { 0 };
+    uint64_t m_dateFormatCacheMisses { 0 };
+
+    // Opening the formatters parses the skeleton and loads locale data. Number.prototype.toLocaleString with
+    // options creates a NumberFormat per call, so keep the most recently used ones around to share.
+    struct NumberFormatCacheEntry {
+        CString locale;
+        String skeleton;
+        Ref<IntlSharedNumberFormatters> formatters;
+    };
+    static constexpr size_t numberFormatCacheCapacity = 8;
+    Vector<NumberFormatCacheEntry, numberFormatCacheCapacity> m_numberFormatCache; // Most recently used first.
+    uint64_t m_numberFormatCacheHits { 0 };
+    uint64_t m_numberFormatCacheMisses { 0 };
 };
 
 } // namespace JSC
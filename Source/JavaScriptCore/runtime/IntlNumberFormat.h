@@ -41,6 +41,7 @@ struct UNumberRangeFormatter;
 namespace JSC {
 
 class IntlFieldIterator;
+class IntlSharedNumberFormatters;
 class JSBoundFunction;
 enum class RelevantExtensionKey : uint8_t;
 
@@ -139,10 +140,7 @@ public:
 
     static constexpr DestructionMode needsDestruction = NeedsDestruction;
 
-    static void destroy(JSCell* cell)
-    {
-        static_cast<IntlNumberFormat*>(cell)->IntlNumberFormat::~IntlNumberFormat();
-    }
+    static void destroy(JSCell*);
 
     template<typename CellType, SubspaceAccess mode>
     static GCClient::IsoSubspace* subspaceFor(VM& vm)
@@ -212,8 +210,7 @@ private:
     static JSValue useGroupingValue(VM&, UseGrouping);
 
     WriteBarrier<JSBoundFunction> m_boundFormat;
-    std::unique_ptr<UNumberFormatter, UNumberFormatterDeleter> m_numberFormatter;
-    std::unique_ptr<UNumberRangeFormatter, UNumberRangeFormatterDeleter> m_numberRangeFormatter;
+    RefPtr<IntlSharedNumberFormatters> m_formatters;
 
     String m_locale;
     String m_numberingSystem;
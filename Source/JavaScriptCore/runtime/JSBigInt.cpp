@@ -678,6 +678,12 @@ JSValue JSBigInt::exponentiate(JSGlobalObject* globalObject, int32_t base, int32
 }
 #endif
 
+// Sizes, in digits, above which the sub-quadratic algorithms for large BigInts beat the schoolbook
+// ones. Below them, the lower constant factors of the schoolbook algorithms win.
+static constexpr size_t karatsubaThreshold = 34;
+static constexpr size_t burnikelZieglerThreshold = 80;
+static constexpr size_t toStringDivideAndConquerThreshold = 64;
+
 template <typename BigIntImpl1, typename BigIntImpl2>
 JSBigInt::ImplResult JSBigInt::multiplyImpl(JSGlobalObject* globalObject, BigIntImpl1 x, BigIntImpl2 y)
 {
@@ -694,6 +700,14 @@ JSBigInt::ImplResult JSBigInt::multiplyImpl(JSGlobalObject* globalObject, BigInt
     RETURN_IF_EXCEPTION(scope, nullptr);
     result->initialize(InitializationType::WithZero);
 
+    if constexpr (std::is_same_v<BigIntImpl1, HeapBigIntImpl> && std::is_same_v<BigIntImpl2, HeapBigIntImpl>) {
+        if (std::min(x.length(), y.length()) >= karatsubaThreshold) {
+            multiplyDigits(result->digits(), x.toHeapBigInt(globalObject)->digits(), y.toHeapBigInt(globalObject)->digits());
+            result->setSign(x.sign() != y.sign());
+            RELEASE_AND_RETURN(scope, result->rightTrim(globalObject));
+        }
+    }
+
     for (unsigned i = 0; i < x.length(); i++)
         multiplyAccumulate(y, x.digit(i), result, i);
 
@@ -1701,6 +1715,28 @@ void JSBigInt::absoluteDivWithBigIntDivisor(JSGlobalObject* globalObject, BigInt
     // come up with more descriptive names for them.
     unsigned n = divisor->length();
     unsigned m = dividend.length() - n;
+
+    if (n >= burnikelZieglerThreshold && m >= burnikelZieglerThreshold) {
+        JSBigInt* dividendBigInt = dividend.toHeapBigInt(globalObject);
+        RETURN_IF_EXCEPTION(scope, void());
+        JSBigInt* q = nullptr;
+        if (quotient) {
+            q = createWithLength(globalObject, m + 1);
+            RETURN_IF_EXCEPTION(scope, void());
+        }
+        JSBigInt* r = nullptr;
+        if (remainder) {
+            r = createWithLength(globalObject, n);
+            RETURN_IF_EXCEPTION(scope, void());
+        }
+        divideDigits(q ? q->digits() : std::span<Digit> { }, r ? r->digits() : std::span<Digit> { }, dividendBigInt->digits(), divisor->digits());
+        // Caller will right-trim.
+        if (quotient)
+            *quotient = q;
+        if (remainder)
+            *remainder = r;
+        return;
+    }
     
     // The quotient to be computed.
     JSBigInt* q = nullptr;
@@ -1857,6 +1893,403 @@ void JSBigInt::inplaceRightShift(unsigned shift)
     setDigit(last, carry);
 }
 
+// The functions below work on spans of digits, least significant digit first.
+
+// Returns the bits shifted out of the most significant digit. {result} may be the same as {x}.
+static JSBigInt::Digit leftShiftDigits(std::span<JSBigInt::Digit> result, std::span<const JSBigInt::Digit> x, unsigned shift)
+{
+    ASSERT(result.size() >= x.size());
+    constexpr unsigned digitBits = sizeof(JSBigInt::Digit) * 8;
+    ASSERT(shift < digitBits);
+    if (!shift) {
+        std::copy(x.begin(), x.end(), result.begin());
+        return 0;
+    }
+    JSBigInt::Digit carry = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        JSBigInt::Digit digit = x[i];
+        result[i] = (digit << shift) | carry;
+        carry = digit >> (digitBits - shift);
+    }
+    return carry;
+}
+
+// {result} may be the same as {x}.
+static void rightShiftDigits(std::span<JSBigInt::Digit> result, std::span<const JSBigInt::Digit> x, unsigned shift)
+{
+    ASSERT(result.size() >= x.size());
+    constexpr unsigned digitBits = sizeof(JSBigInt::Digit) * 8;
+    ASSERT(shift < digitBits);
+    if (!shift) {
+        std::copy(x.begin(), x.end(), result.begin());
+        return;
+    }
+    for (size_t i = 0; i < x.size(); ++i) {
+        JSBigInt::Digit high = i + 1 < x.size() ? x[i + 1] << (digitBits - shift) : 0;
+        result[i] = (x[i] >> shift) | high;
+    }
+}
+
+static int compareDigits(std::span<const JSBigInt::Digit> x, std::span<const JSBigInt::Digit> y)
+{
+    ASSERT(x.size() == y.size());
+    for (size_t i = x.size(); i--;) {
+        if (x[i] != y[i])
+            return x[i] < y[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+static std::span<const JSBigInt::Digit> trimDigits(std::span<const JSBigInt::Digit> x)
+{
+    while (!x.empty() && !x.back())
+        x = x.first(x.size() - 1);
+    return x;
+}
+
+// Adds {y} to {x} in place and returns the carry out of {x}.
+JSBigInt::Digit JSBigInt::addDigits(std::span<Digit> x, std::span<const Digit> y)
+{
+    ASSERT(x.size() >= y.size());
+    Digit carry = 0;
+    size_t i = 0;
+    for (; i < y.size(); ++i) {
+        Digit newCarry = 0;
+        Digit sum = digitAdd(x[i], y[i], newCarry);
+        x[i] = digitAdd(sum, carry, newCarry);
+        carry = newCarry;
+    }
+    for (; carry && i < x.size(); ++i) {
+        Digit newCarry = 0;
+        x[i] = digitAdd(x[i], carry, newCarry);
+        carry = newCarry;
+    }
+    return carry;
+}
+
+// Subtracts {y} from {x} in place and returns the borrow out of {x}.
+JSBigInt::Digit JSBigInt::subtractDigits(std::span<Digit> x, std::span<const Digit> y)
+{
+    ASSERT(x.size() >= y.size());
+    Digit borrow = 0;
+    size_t i = 0;
+    for (; i < y.size(); ++i) {
+        Digit newBorrow = 0;
+        Digit difference = digitSub(x[i], y[i], newBorrow);
+        x[i] = digitSub(difference, borrow, newBorrow);
+        borrow = newBorrow;
+    }
+    for (; borrow && i < x.size(); ++i) {
+        Digit newBorrow = 0;
+        x[i] = digitSub(x[i], borrow, newBorrow);
+        borrow = newBorrow;
+    }
+    return borrow;
+}
+
+void JSBigInt::multiplyDigitsSchoolbook(std::span<Digit> result, std::span<const Digit> x, std::span<const Digit> y)
+{
+    ASSERT(result.size() >= x.size() + y.size());
+    std::fill(result.begin(), result.end(), 0);
+    for (size_t i = 0; i < x.size(); ++i) {
+        Digit multiplier = x[i];
+        if (!multiplier)
+            continue;
+        // multiplier * y[j] + result[i + j] + carry always fits in two digits.
+        Digit carry = 0;
+        for (size_t j = 0; j < y.size(); ++j) {
+            Digit high = 0;
+            Digit low = digitMul(multiplier, y[j], high);
+            Digit acc = digitAdd(result[i + j], low, high);
+            result[i + j] = digitAdd(acc, carry, high);
+            carry = high;
+        }
+        result[i + y.size()] = carry;
+    }
+}
+
+// x = x1 * B^h + x0 and y = y1 * B^h + y0, so x * y = z2 * B^2h + z1 * B^h + z0 where z0 = x0 * y0,
+// z2 = x1 * y1 and z1 = (x0 + x1) * (y0 + y1) - z0 - z2. That takes three half-size products instead of four.
+void JSBigInt::multiplyDigitsKaratsuba(std::span<Digit> result, std::span<const Digit> x, std::span<const Digit> y)
+{
+    ASSERT(x.size() >= y.size());
+    ASSERT(2 * y.size() > x.size());
+    ASSERT(result.size() >= x.size() + y.size());
+
+    size_t half = x.size() / 2;
+    auto x0 = x.first(half);
+    auto x1 = x.subspan(half);
+    auto y0 = y.first(half);
+    auto y1 = y.subspan(half);
+
+    std::fill(result.begin() + x.size() + y.size(), result.end(), 0);
+    auto z0 = result.first(2 * half);
+    auto z2 = result.subspan(2 * half, x1.size() + y1.size());
+    multiplyDigits(z0, x0, y0);
+    multiplyDigits(z2, x1, y1);
+
+    auto sum = [](std::span<const Digit> a, std::span<const Digit> b) {
+        if (a.size() < b.size())
+            std::swap(a, b);
+        Vector<Digit> result(a.size() + 1);
+        std::copy(a.begin(), a.end(), result.begin());
+        result.last() = addDigits(result.mutableSpan().first(a.size()), b);
+        return result;
+    };
+    Vector<Digit> xSum = sum(x0, x1);
+    Vector<Digit> ySum = sum(y0, y1);
+    Vector<Digit> z1(xSum.size() + ySum.size());
+    multiplyDigits(z1.mutableSpan(), xSum.span(), ySum.span());
+    Digit borrow = subtractDigits(z1.mutableSpan(), z0);
+    borrow += subtractDigits(z1.mutableSpan(), z2);
+    ASSERT_UNUSED(borrow, !borrow);
+
+    Digit carry = addDigits(result.subspan(half), trimDigits(z1.span()));
+    ASSERT_UNUSED(carry, !carry);
+}
+
+// {result} must have room for x.size() + y.size() digits, and must not overlap {x} or {y}.
+void JSBigInt::multiplyDigits(std::span<Digit> result, std::span<const Digit> x, std::span<const Digit> y)
+{
+    if (x.size() < y.size())
+        std::swap(x, y);
+    ASSERT(result.size() >= x.size() + y.size());
+
+    if (y.size() < karatsubaThreshold) {
+        multiplyDigitsSchoolbook(result, x, y);
+        return;
+    }
+
+    if (x.size() >= 2 * y.size()) {
+        // Karatsuba needs balanced operands, so multiply {y} by {y} sized chunks of {x}.
+        std::fill(result.begin(), result.end(), 0);
+        Vector<Digit> product(2 * y.size());
+        for (size_t i = 0; i < x.size(); i += y.size()) {
+            auto chunk = x.subspan(i, std::min(y.size(), x.size() - i));
+            auto chunkProduct = product.mutableSpan().first(chunk.size() + y.size());
+            multiplyDigits(chunkProduct, chunk, y);
+            Digit carry = addDigits(result.subspan(i), chunkProduct);
+            ASSERT_UNUSED(carry, !carry);
+        }
+        return;
+    }
+
+    multiplyDigitsKaratsuba(result, x, y);
+}
+
+// Knuth, Volume 2, section 4.3.1, Algorithm D. Same as absoluteDivWithBigIntDivisor, on spans.
+// {quotient} needs room for dividend.size() - divisor.size() + 1 digits, and {remainder} for
+// divisor.size() digits. Either can be empty if the caller does not need it.
+void JSBigInt::divideDigitsSchoolbook(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor)
+{
+    size_t n = divisor.size();
+    ASSERT(n >= 2);
+    ASSERT(divisor.back());
+    ASSERT(dividend.size() >= n);
+    size_t m = dividend.size() - n;
+    ASSERT(quotient.empty() || quotient.size() > m);
+    ASSERT(remainder.empty() || remainder.size() >= n);
+
+    unsigned shift = clz(divisor.back());
+    Vector<Digit> v(n);
+    leftShiftDigits(v.mutableSpan(), divisor, shift);
+    Vector<Digit> u(dividend.size() + 1);
+    u.last() = leftShiftDigits(u.mutableSpan(), dividend, shift);
+    Vector<Digit> qhatv(n + 1);
+
+    Digit vn1 = v[n - 1];
+    Digit vn2 = v[n - 2];
+    for (size_t j = m + 1; j--;) {
+        Digit qhat = std::numeric_limits<Digit>::max();
+        Digit ujn = u[j + n];
+        if (ujn != vn1) {
+            Digit rhat = 0;
+            qhat = digitDiv(ujn, u[j + n - 1], vn1, rhat);
+            Digit ujn2 = u[j + n - 2];
+            while (productGreaterThan(qhat, vn2, rhat, ujn2)) {
+                qhat--;
+                Digit prevRhat = rhat;
+                rhat += vn1;
+                if (rhat < prevRhat)
+                    break;
+            }
+        }
+
+        Digit carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            Digit high = 0;
+            Digit low = digitMul(qhat, v[i], high);
+            qhatv[i] = digitAdd(low, carry, high);
+            carry = high;
+        }
+        qhatv[n] = carry;
+
+        auto window = u.mutableSpan().subspan(j, n + 1);
+        if (subtractDigits(window, qhatv.span())) {
+            addDigits(window, v.span());
+            qhat--;
+        }
+
+        if (!quotient.empty())
+            quotient[j] = qhat;
+    }
+
+    if (!quotient.empty())
+        std::fill(quotient.begin() + m + 1, quotient.end(), 0);
+    if (!remainder.empty()) {
+        rightShiftDigits(remainder, u.span().first(n), shift);
+        std::fill(remainder.begin() + n, remainder.end(), 0);
+    }
+}
+
+// Divides the 3k digit {dividend} by the 2k digit {divisor}, given that dividend < divisor * B^k
+// and that the most significant bit of {divisor} is set. {quotient} has k digits, {remainder} 2k.
+void JSBigInt::divideDigits3By2(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor)
+{
+    size_t k = divisor.size() / 2;
+    ASSERT(divisor.size() == 2 * k);
+    ASSERT(dividend.size() == 3 * k);
+    ASSERT(quotient.size() == k);
+    ASSERT(remainder.size() == 2 * k);
+
+    auto a1 = dividend.subspan(2 * k);
+    auto a12 = dividend.subspan(k);
+    auto a3 = dividend.first(k);
+    auto b1 = divisor.subspan(k);
+    auto b2 = divisor.first(k);
+
+    // rHat = [r1, a3], where r1 is the remainder of [a1, a2] / b1. It gets an extra digit, since r1
+    // can be k + 1 digits long below.
+    Vector<Digit> rHat(2 * k + 1, 0);
+    auto r1 = rHat.mutableSpan().subspan(k);
+    if (compareDigits(a1, b1) < 0)
+        divideDigits2By1(quotient, r1.first(k), a12, b1);
+    else {
+        // dividend < divisor * B^k means a1 <= b1, so a1 == b1 here. The quotient digit estimate is
+        // then B^k - 1, and r1 = [a1, a2] - (B^k - 1) * b1 = a2 + b1.
+        ASSERT(!compareDigits(a1, b1));
+        std::fill(quotient.begin(), quotient.end(), std::numeric_limits<Digit>::max());
+        auto a2 = dividend.subspan(k, k);
+        std::copy(a2.begin(), a2.end(), r1.begin());
+        r1[k] = addDigits(r1.first(k), b1);
+    }
+    std::copy(a3.begin(), a3.end(), rHat.begin());
+
+    // The estimate can be at most two too large, in which case rHat - quotient * b2 is negative.
+    Vector<Digit> d(2 * k);
+    multiplyDigits(d.mutableSpan(), quotient, b2);
+    Digit borrow = subtractDigits(rHat.mutableSpan(), d.span());
+    while (borrow) {
+        static constexpr Digit one = 1;
+        subtractDigits(quotient, std::span { &one, 1 });
+        borrow -= addDigits(rHat.mutableSpan(), divisor);
+    }
+
+    ASSERT(!rHat.last());
+    std::copy(rHat.begin(), rHat.end() - 1, remainder.begin());
+}
+
+// Divides the 2n digit {dividend} by the n digit {divisor}, given that dividend < divisor * B^n
+// and that the most significant bit of {divisor} is set. {quotient} and {remainder} have n digits.
+void JSBigInt::divideDigits2By1(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor)
+{
+    size_t n = divisor.size();
+    ASSERT(dividend.size() == 2 * n);
+    ASSERT(quotient.size() == n);
+    ASSERT(remainder.size() == n);
+
+    if ((n % 2) || n < burnikelZieglerThreshold) {
+        Vector<Digit> wideQuotient(n + 1);
+        divideDigitsSchoolbook(wideQuotient.mutableSpan(), remainder, dividend, divisor);
+        ASSERT(!wideQuotient.last());
+        std::copy(wideQuotient.begin(), wideQuotient.end() - 1, quotient.begin());
+        return;
+    }
+
+    // With dividend = [a1, a2, a3, a4] in n / 2 digit blocks, divide [a1, a2, a3] and then [r, a4].
+    size_t half = n / 2;
+    Vector<Digit> r(3 * half);
+    divideDigits3By2(quotient.subspan(half), r.mutableSpan().subspan(half), dividend.subspan(half), divisor);
+    auto a4 = dividend.first(half);
+    std::copy(a4.begin(), a4.end(), r.begin());
+    divideDigits3By2(quotient.first(half), remainder, r.span(), divisor);
+}
+
+// Burnikel and Ziegler, "Fast Recursive Division", 1998. Divides by splitting the dividend into
+// blocks of the divisor's size, so that each step is a 2n by n division, which recursively turns
+// into multiplications that can use Karatsuba.
+void JSBigInt::divideDigitsBurnikelZiegler(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor)
+{
+    size_t s = divisor.size();
+    ASSERT(divisor.back());
+    ASSERT(dividend.size() >= s);
+
+    // Pick the block size n = j * m, with m a power of two, such that the recursion in divideDigits2By1
+    // halves n down to j <= burnikelZieglerThreshold.
+    size_t m = 1;
+    while (m * burnikelZieglerThreshold <= s)
+        m *= 2;
+    size_t j = (s + m - 1) / m;
+    size_t n = j * m;
+
+    // Normalize the divisor to exactly n digits with its most significant bit set, and shift the
+    // dividend by the same amount.
+    size_t digitShift = n - s;
+    unsigned bitShift = clz(divisor.back());
+    Vector<Digit> b(n, 0);
+    leftShiftDigits(b.mutableSpan().subspan(digitShift), divisor, bitShift);
+
+    // The dividend is split into t blocks of n digits, such that the most significant block is less than
+    // B^n / 2 <= b, which makes each step's quotient fit in n digits.
+    size_t shiftedLength = dividend.size() + digitShift + 1;
+    size_t t = std::max<size_t>((shiftedLength + n - 1) / n, 2);
+    Vector<Digit> a(t * n, 0);
+    a[digitShift + dividend.size()] = leftShiftDigits(a.mutableSpan().subspan(digitShift), dividend, bitShift);
+    if (a.last() >> (digitBits - 1)) {
+        ++t;
+        a.grow(t * n);
+        std::fill(a.end() - n, a.end(), 0);
+    }
+
+    Vector<Digit> z(2 * n);
+    std::copy_n(a.begin() + (t - 2) * n, 2 * n, z.begin());
+    Vector<Digit> q(n);
+    Vector<Digit> r(n);
+    for (size_t i = t - 1; i--;) {
+        divideDigits2By1(q.mutableSpan(), r.mutableSpan(), z.span(), b.span());
+        if (!quotient.empty()) {
+            for (size_t index = 0; index < n; ++index) {
+                if (i * n + index < quotient.size())
+                    quotient[i * n + index] = q[index];
+                else
+                    ASSERT(!q[index]);
+            }
+        }
+        if (!i)
+            break;
+        std::copy_n(a.begin() + (i - 1) * n, n, z.begin());
+        std::copy(r.begin(), r.end(), z.begin() + n);
+    }
+
+    if (!remainder.empty()) {
+        ASSERT(std::all_of(r.begin(), r.begin() + digitShift, [](Digit digit) { return !digit; }));
+        rightShiftDigits(remainder, r.span().subspan(digitShift), bitShift);
+        std::fill(remainder.begin() + s, remainder.end(), 0);
+    }
+}
+
+// Same contract as divideDigitsSchoolbook.
+void JSBigInt::divideDigits(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor)
+{
+    if (divisor.size() < burnikelZieglerThreshold || dividend.size() - divisor.size() < burnikelZieglerThreshold) {
+        divideDigitsSchoolbook(quotient, remainder, dividend, divisor);
+        return;
+    }
+    if (!quotient.empty())
+        std::fill(quotient.begin(), quotient.end(), 0);
+    divideDigitsBurnikelZiegler(quotient, remainder, dividend, divisor);
+}
+
 // Always copies the input, even when {shift} == 0.
 template <typename BigIntImpl>
 JSBigInt* JSBigInt::absoluteLeftShiftAlwaysCopy(JSGlobalObject* globalObject, BigIntImpl x, unsigned shift, LeftShiftMode mode)
@@ -2308,6 +2741,45 @@ String JSBigInt::toStringBasePowerOfTwo(VM& vm, JSGlobalObject* nullOrGlobalObje
     return StringImpl::adopt(WTFMove(resultString));
 }
 
+// Appends the characters of {x} in {radix}, least significant first, padded with zeros to {minimumLength}.
+// {powers}[k] is radix^(chunkChars * 2^k), and {powers}[0] fits in one digit.
+void JSBigInt::toStringDivideAndConquer(Vector<LChar>& result, std::span<const Digit> x, unsigned radix, unsigned chunkChars, const Vector<Vector<Digit>>& powers, size_t minimumLength)
+{
+    size_t start = result.size();
+    x = trimDigits(x);
+    if (x.size() < toStringDivideAndConquerThreshold) {
+        Digit chunkDivisor = powers[0][0];
+        Vector<Digit> rest(x);
+        size_t restLength = rest.size();
+        while (restLength) {
+            Digit chunk = 0;
+            for (size_t i = restLength; i--;)
+                rest[i] = digitDiv(chunk, rest[i], chunkDivisor, chunk);
+            if (!rest[restLength - 1])
+                restLength--;
+            for (unsigned i = 0; i < chunkChars; i++) {
+                result.append(radixDigits[chunk % radix]);
+                chunk /= radix;
+            }
+        }
+    } else {
+        // Split {x} at the largest power that is about half its length, so that both halves recurse evenly.
+        size_t level = 0;
+        while (level + 1 < powers.size() && powers[level + 1].size() <= (x.size() + 1) / 2)
+            level++;
+        auto& divisor = powers[level];
+        Vector<Digit> quotient(x.size() - divisor.size() + 1);
+        Vector<Digit> remainder(divisor.size());
+        divideDigits(quotient.mutableSpan(), remainder.mutableSpan(), x, divisor.span());
+
+        size_t remainderLength = static_cast<size_t>(chunkChars) << level;
+        toStringDivideAndConquer(result, remainder.span(), radix, chunkChars, powers, remainderLength);
+        toStringDivideAndConquer(result, quotient.span(), radix, chunkChars, powers, minimumLength > remainderLength ? minimumLength - remainderLength : 0);
+    }
+    while (result.size() - start < minimumLength)
+        result.append('0');
+}
+
 String JSBigInt::toStringGeneric(VM& vm, JSGlobalObject* nullOrGlobalObjectForOOM, JSBigInt* x, unsigned radix)
 {
     // FIXME: [JSC] Revisit usage of Vector into JSBigInt::toString
@@ -2331,54 +2803,69 @@ String JSBigInt::toStringGeneric(VM& vm, JSGlobalObject* nullOrGlobalObjectForOO
         return String();
     }
 
-    Digit lastDigit;
-    if (length == 1)
-        lastDigit = x->digit(0);
-    else {
-        unsigned chunkChars = digitBits * bitsPerCharTableMultiplier / maxBitsPerChar;
-        Digit chunkDivisor = digitPow(radix, chunkChars);
+    unsigned chunkChars = digitBits * bitsPerCharTableMultiplier / maxBitsPerChar;
+    if (length >= toStringDivideAndConquerThreshold) {
+        // Repeatedly dividing by chunkDivisor is quadratic. Instead, split x in halves by dividing by
+        // radix^(chunkChars * 2^k), and convert each half recursively.
+        Vector<Vector<Digit>> powers;
+        powers.append(Vector<Digit> { digitPow(radix, chunkChars) });
+        while (2 * powers.last().size() <= length) {
+            auto& power = powers.last();
+            Vector<Digit> square(2 * power.size());
+            multiplyDigits(square.mutableSpan(), power.span(), power.span());
+            if (!square.last())
+                square.removeLast();
+            powers.append(WTFMove(square));
+        }
+        toStringDivideAndConquer(resultString, x->digits(), radix, chunkChars, powers, 0);
+    } else {
+        Digit lastDigit;
+        if (length == 1)
+            lastDigit = x->digit(0);
+        else {
+            Digit chunkDivisor = digitPow(radix, chunkChars);
+
+            // By construction of chunkChars, there can't have been overflow.
+            ASSERT(chunkDivisor);
+            unsigned nonZeroDigit = length - 1;
+            ASSERT(x->digit(nonZeroDigit));
+
+            // {rest} holds the part of the BigInt that we haven't looked at yet.
+            // Not to be confused with "remainder"!
+            JSBigInt* rest = nullptr;
+
+            // In the first round, divide the input, allocating a new BigInt for
+            // the result == rest; from then on divide the rest in-place.
+            JSBigInt** dividend = &x;
+            do {
+                Digit chunk;
+                bool success = absoluteDivWithDigitDivisor(nullOrGlobalObjectForOOM, vm, HeapBigIntImpl { *dividend }, chunkDivisor, &rest, chunk);
+                if (!success)
+                    return String();
+                dividend = &rest;
+                for (unsigned i = 0; i < chunkChars; i++) {
+                    resultString.append(radixDigits[chunk % radix]);
+                    chunk /= radix;
+                }
+                ASSERT(!chunk);
 
-        // By construction of chunkChars, there can't have been overflow.
-        ASSERT(chunkDivisor);
-        unsigned nonZeroDigit = length - 1;
-        ASSERT(x->digit(nonZeroDigit));
+                if (!rest->digit(nonZeroDigit))
+                    nonZeroDigit--;
 
-        // {rest} holds the part of the BigInt that we haven't looked at yet.
-        // Not to be confused with "remainder"!
-        JSBigInt* rest = nullptr;
+                // We can never clear more than one digit per iteration, because
+                // chunkDivisor is smaller than max digit value.
+                ASSERT(rest->digit(nonZeroDigit));
+            } while (nonZeroDigit > 0);
 
-        // In the first round, divide the input, allocating a new BigInt for
-        // the result == rest; from then on divide the rest in-place.
-        JSBigInt** dividend = &x;
-        do {
-            Digit chunk;
-            bool success = absoluteDivWithDigitDivisor(nullOrGlobalObjectForOOM, vm, HeapBigIntImpl { *dividend }, chunkDivisor, &rest, chunk);
-            if (!success)
-                return String();
-            dividend = &rest;
-            for (unsigned i = 0; i < chunkChars; i++) {
-                resultString.append(radixDigits[chunk % radix]);
-                chunk /= radix;
-            }
-            ASSERT(!chunk);
-
-            if (!rest->digit(nonZeroDigit))
-                nonZeroDigit--;
-
-            // We can never clear more than one digit per iteration, because
-            // chunkDivisor is smaller than max digit value.
-            ASSERT(rest->digit(nonZeroDigit));
-        } while (nonZeroDigit > 0);
+            lastDigit = rest->digit(0);
+        }
 
-        lastDigit = rest->digit(0);
+        do {
+            resultString.append(radixDigits[lastDigit % radix]);
+            lastDigit /= radix;
+        } while (lastDigit > 0);
     }
-
-    do {
-        resultString.append(radixDigits[lastDigit % radix]);
-        lastDigit /= radix;
-    } while (lastDigit > 0);
     ASSERT(resultString.size());
-    ASSERT(resultString.size() <= static_cast<size_t>(maximumCharactersRequired));
 
     // Remove leading zeroes.
     unsigned newSizeNoLeadingZeroes = resultString.size();
@@ -2386,6 +2873,7 @@ String JSBigInt::toStringGeneric(VM& vm, JSGlobalObject* nullOrGlobalObjectForOO
         newSizeNoLeadingZeroes--;
 
     resultString.shrink(newSizeNoLeadingZeroes);
+    ASSERT(resultString.size() <= static_cast<size_t>(maximumCharactersRequired));
 
     if (sign)
         resultString.append('-');
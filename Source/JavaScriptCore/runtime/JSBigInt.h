@@ -555,6 +555,19 @@ private:
     Digit absoluteInplaceSub(JSBigInt* subtrahend, unsigned startIndex);
     void inplaceRightShift(unsigned shift);
 
+    // Sub-quadratic algorithms for large BigInts. They work on spans of digits, least significant first.
+    static Digit addDigits(std::span<Digit> x, std::span<const Digit> y);
+    static Digit subtractDigits(std::span<Digit> x, std::span<const Digit> y);
+    static void multiplyDigits(std::span<Digit> result, std::span<const Digit> x, std::span<const Digit> y);
+    static void multiplyDigitsSchoolbook(std::span<Digit> result, std::span<const Digit> x, std::span<const Digit> y);
+    static void multiplyDigitsKaratsuba(std::span<Digit> result, std::span<const Digit> x, std::span<const Digit> y);
+    static void divideDigits(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor);
+    static void divideDigitsSchoolbook(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor);
+    static void divideDigitsBurnikelZiegler(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor);
+    static void divideDigits2By1(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor);
+    static void divideDigits3By2(std::span<Digit> quotient, std::span<Digit> remainder, std::span<const Digit> dividend, std::span<const Digit> divisor);
+    static void toStringDivideAndConquer(Vector<LChar>&, std::span<const Digit>, unsigned radix, unsigned chunkChars, const Vector<Vector<Digit>>& powers, size_t minimumLength);
+
     enum class RoundingResult {
         RoundDown,
         Tie,
@@ -639,6 +652,7 @@ private:
     JS_EXPORT_PRIVATE static uint64_t toBigUInt64Heap(JSBigInt*);
 
     inline Digit* dataStorage() { return m_data.get(); }
+    std::span<Digit> digits() { return { dataStorage(), length() }; }
     inline Digit* dataStorageUnsafe() { return m_data.getUnsafe(); }
 
     const unsigned m_length;
@@ -389,6 +389,23 @@ double DateCache::parseDate(JSGlobalObject* globalObject, VM& vm, const String&
     if (date == m_cachedDateString)
         return m_cachedDateStringValue;
 
+    auto applyLocalTimeOffset = [this] (double value, bool isLocalTime) {
+        if (isLocalTime && std::isfinite(value))
+            value -= localTimeOffset(static_cast<int64_t>(value), TimeType::LocalTime).offset;
+        return value;
+    };
+
+    // Machine generated timestamps can be parsed straight out of the string's characters,
+    // without the copies below.
+    if (date.is8Bit()) {
+        bool isLocalTime;
+        if (auto value = WTF::parseDateFast(date.span8(), isLocalTime)) {
+            m_cachedDateString = date;
+            m_cachedDateStringValue = applyLocalTimeOffset(*value, isLocalTime);
+            return m_cachedDateStringValue;
+        }
+    }
+
     // After ICU 72, CLDR generates narrowNoBreakSpace for date time format. Thus, `new Date().toLocaleString('en-US')` starts generating
     // a string including narrowNoBreakSpaces instead of simple spaces. However since code in the wild assumes `new Date(new Date().toLocaleString('en-US'))`
     // works, we need to maintain the ability to parse string including narrowNoBreakSpaces. Rough consensus among implementaters is replacing narrowNoBreakSpaces
@@ -405,16 +422,12 @@ double DateCache::parseDate(JSGlobalObject* globalObject, VM& vm, const String&
         return std::numeric_limits<double>::quiet_NaN();
     }
 
-    auto parseDateImpl = [this] (auto dateString) {
+    auto parseDateImpl = [&] (auto dateString) {
         bool isLocalTime;
         double value = WTF::parseES5Date(dateString, isLocalTime);
         if (std::isnan(value))
             value = WTF::parseDate(dateString, isLocalTime);
-
-        if (isLocalTime && std::isfinite(value))
-            value -= localTimeOffset(static_cast<int64_t>(value), TimeType::LocalTime).offset;
-
-        return value;
+        return applyLocalTimeOffset(value, isLocalTime);
     };
 
     // FIXME: expectedString is UTF-8 but parseDateImpl requires Latin1. Which is correct?
@@ -213,6 +213,10 @@ protected:
     // are 1 and only the MSB of the mantissa is 1. So, NaN is recognized as the largest integral numbers.
 
     template<typename IntegralType> inline void sortFloat(ElementType* begin, ElementType* end);
+
+    // 8-bit and 16-bit integers have so few distinct values that counting how many times each of them
+    // occurs sorts in linear time. Below a few times the number of distinct values, std::sort is faster.
+    template<typename IntegralType> inline void sortByCounting(ElementType* begin, ElementType* end);
 };
 
 template<typename PassedAdaptor>
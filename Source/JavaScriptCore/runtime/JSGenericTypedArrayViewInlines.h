@@ -35,6 +35,7 @@
 #include "TypeError.h"
 #include "TypedArrays.h"
 #include <wtf/CheckedArithmetic.h>
+#include <wtf/UnalignedAccess.h>
 #include <wtf/text/MakeString.h>
 
 WTF_ALLOW_UNSAFE_BUFFER_USAGE_BEGIN
@@ -226,43 +227,53 @@ bool JSGenericTypedArrayView<Adaptor>::setWithSpecificType(
     //       copy is in order.
     // 3) If we have different element sizes and there is a chance of overlap then
     //    we need an intermediate vector.
+    // 4) Unless the copy is observably left to right, as in %TypedArray%.prototype.slice
+    //    with a species constructor that shares the buffer. Then each element has to be
+    //    read after the previous one has been stored, even if that store overwrote it.
     
     // NB. Comparisons involving elementSize will be constant-folded by template
     // specialization.
 
     unsigned otherElementSize = sizeof(typename OtherAdaptor::Type);
 
+    // Load the vectors once. Going through setIndexQuicklyToNativeValue reloads typedVector() after every
+    // store, since an int8 or uint8 store may alias it, and that keeps these loops from being vectorized.
+    ASSERT(canAccessRangeQuickly(offset, length));
+    typename Adaptor::Type* destination = typedVector() + offset;
+    const typename OtherAdaptor::Type* source = other->typedVector() + otherOffset;
+
     // Handle cases (1) and (2A).
     if (!hasArrayBuffer() || !other->hasArrayBuffer()
         || existingBuffer() != other->existingBuffer()
-        || (elementSize == otherElementSize && (static_cast<void*>(typedVector() + offset) <= static_cast<void*>(other->typedVector() + otherOffset)))
-        || type == CopyType::LeftToRight) {
+        || (elementSize == otherElementSize && (static_cast<void*>(destination) <= static_cast<const void*>(source)))) {
+        for (size_t i = 0; i < length; ++i)
+            destination[i] = OtherAdaptor::template convertTo<Adaptor>(source[i]);
+        return true;
+    }
+
+    // Handle case (4). The element types differ, so access them as bytes. Otherwise the compiler may assume
+    // that the stores cannot change the source, and hoist loads above them or vectorize the loop.
+    if (type == CopyType::LeftToRight) {
         for (size_t i = 0; i < length; ++i) {
-            setIndexQuicklyToNativeValue(
-                offset + i, OtherAdaptor::template convertTo<Adaptor>(
-                    other->getIndexQuicklyAsNativeValue(i + otherOffset)));
+            auto value = WTF::unalignedLoad<typename OtherAdaptor::Type>(source + i);
+            WTF::unalignedStore<typename Adaptor::Type>(destination + i, OtherAdaptor::template convertTo<Adaptor>(value));
         }
         return true;
     }
 
     // Now we either have (2B) or (3) - so first we try to cover (2B).
     if (elementSize == otherElementSize) {
-        for (size_t i = length; i--;) {
-            setIndexQuicklyToNativeValue(
-                offset + i, OtherAdaptor::template convertTo<Adaptor>(
-                    other->getIndexQuicklyAsNativeValue(i + otherOffset)));
-        }
+        for (size_t i = length; i--;)
+            destination[i] = OtherAdaptor::template convertTo<Adaptor>(source[i]);
         return true;
     }
     
     // Fail: we need an intermediate transfer buffer (i.e. case (3)).
     auto transfer = [&] (auto& buffer) {
-        for (size_t i = length; i--;) {
-            buffer[i] = OtherAdaptor::template convertTo<Adaptor>(
-                other->getIndexQuicklyAsNativeValue(i + otherOffset));
-        }
         for (size_t i = length; i--;)
-            setIndexQuicklyToNativeValue(offset + i, buffer[i]);
+            buffer[i] = OtherAdaptor::template convertTo<Adaptor>(source[i]);
+        for (size_t i = length; i--;)
+            destination[i] = buffer[i];
     };
 
     if (WTF::isValidCapacityForVector<typename Adaptor::Type>(length)) {
@@ -903,6 +914,19 @@ template<typename Adaptor> inline auto JSGenericTypedArrayView<Adaptor>::sort()
     case TypeFloat64:
         sortFloat<int64_t>(array, array + length);
         break;
+    case TypeInt8:
+        sortByCounting<int8_t>(array, array + length);
+        break;
+    case TypeUint8:
+    case TypeUint8Clamped:
+        sortByCounting<uint8_t>(array, array + length);
+        break;
+    case TypeInt16:
+        sortByCounting<int16_t>(array, array + length);
+        break;
+    case TypeUint16:
+        sortByCounting<uint16_t>(array, array + length);
+        break;
     default:
         std::sort(array, array + length);
         break;
@@ -991,6 +1015,34 @@ inline void JSGenericTypedArrayView<Adaptor>::sortFloat(ElementType* begin, Elem
     });
 }
 
+template<typename Adaptor> template<typename IntegralType>
+inline void JSGenericTypedArrayView<Adaptor>::sortByCounting(ElementType* begin, ElementType* end)
+{
+    static_assert(sizeof(IntegralType) <= sizeof(uint16_t));
+    ASSERT(sizeof(IntegralType) == sizeof(ElementType));
+
+    constexpr size_t numValues = static_cast<size_t>(std::numeric_limits<IntegralType>::max()) - std::numeric_limits<IntegralType>::min() + 1;
+    constexpr size_t minLength = sizeof(IntegralType) == 1 ? 64 : 4096;
+
+    auto* integralBegin = reinterpret_cast_ptr<IntegralType*>(begin);
+    auto* integralEnd = reinterpret_cast_ptr<IntegralType*>(end);
+
+    Vector<size_t, 256> counts;
+    if (static_cast<size_t>(integralEnd - integralBegin) < minLength || !counts.tryGrow(numValues)) {
+        std::sort(integralBegin, integralEnd);
+        return;
+    }
+
+    std::ranges::fill(counts, 0);
+    for (auto* it = integralBegin; it != integralEnd; ++it)
+        ++counts[static_cast<int>(*it) - std::numeric_limits<IntegralType>::min()];
+
+    auto* it = integralBegin;
+    for (size_t index = 0; index < numValues; ++index)
+        it = std::fill_n(it, counts[index], static_cast<IntegralType>(static_cast<int>(index) + std::numeric_limits<IntegralType>::min()));
+    ASSERT(it == integralEnd);
+}
+
 template<typename Adaptor> RefPtr<typename Adaptor::ViewType> JSGenericTypedArrayView<Adaptor>::toWrapped(VM& vm, JSValue value)
 {
     auto result = JSC::toUnsharedNativeTypedView<Adaptor>(vm, value);
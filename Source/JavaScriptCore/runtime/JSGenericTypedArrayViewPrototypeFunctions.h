@@ -481,13 +481,18 @@ ALWAYS_INLINE EncodedJSValue genericTypedArrayViewProtoFuncIncludes(VM& vm, JSGl
                 }
                 return JSValue::encode(jsBoolean(false));
             }
+        } else if constexpr (ViewClass::elementSize == 4) {
+            if (std::isnan(*targetOption)) {
+                if (index >= searchLength)
+                    return JSValue::encode(jsBoolean(false));
+                return JSValue::encode(jsBoolean(!!WTF::findFloatNaN(std::bit_cast<const float*>(array + index), searchLength - index)));
+            }
         } else {
-            if (std::isnan(static_cast<double>(*targetOption))) {
-                for (; index < searchLength; ++index) {
-                    if (std::isnan(static_cast<double>(array[index])))
-                        return JSValue::encode(jsBoolean(true));
-                }
-                return JSValue::encode(jsBoolean(false));
+            static_assert(ViewClass::elementSize == 8);
+            if (std::isnan(*targetOption)) {
+                if (index >= searchLength)
+                    return JSValue::encode(jsBoolean(false));
+                return JSValue::encode(jsBoolean(!!WTF::findDoubleNaN(std::bit_cast<const double*>(array + index), searchLength - index)));
             }
         }
     }
@@ -177,8 +177,10 @@ GCOwnedDataScope<AtomStringImpl*> JSRopeString::resolveRopeToAtomString(JSGlobal
             resolveRopeInternalNoSubstring(std::span { buffer }.first(length()), stackLimit);
             atomString = std::span<const UChar> { buffer }.first(length());
         }
+        vm.ropeResolutionCopiedBytes += length() * (is8Bit() ? sizeof(LChar) : sizeof(UChar));
     } else
         atomString = StringView { substringBase()->valueInternal() }.substring(substringOffset(), length()).toAtomString();
+    ++vm.ropeResolutionCount;
 
     size_t sizeToReport = atomString.impl()->hasOneRef() ? atomString.impl()->cost() : 0;
     convertToNonRope(String { atomString.releaseImpl() });
@@ -217,8 +219,10 @@ GCOwnedDataScope<AtomStringImpl*> JSRopeString::resolveRopeToExistingAtomString(
             resolveRopeInternalNoSubstring(std::span { buffer }.first(length()), stackLimit);
             existingAtomString = AtomStringImpl::lookUp(std::span { buffer }.first(length()));
         }
+        vm.ropeResolutionCopiedBytes += length() * (is8Bit() ? sizeof(LChar) : sizeof(UChar));
     } else
         existingAtomString = StringView { substringBase()->valueInternal() }.substring(substringOffset(), length()).toExistingAtomString().releaseImpl();
+    ++vm.ropeResolutionCount;
 
     if (existingAtomString)
         convertToNonRope(*existingAtomString);
@@ -231,6 +235,7 @@ const String& JSRopeString::resolveRopeWithFunction(JSGlobalObject* nullOrGlobal
     ASSERT(isRope());
     
     VM& vm = this->vm();
+    ++vm.ropeResolutionCount;
     if (isSubstring()) {
         ASSERT(!substringBase()->isRope());
         auto newImpl = substringBase()->valueInternal().substringSharingImpl(substringOffset(), length());
@@ -247,6 +252,7 @@ const String& JSRopeString::resolveRopeWithFunction(JSGlobalObject* nullOrGlobal
         }
 
         size_t sizeToReport = newImpl->cost();
+        vm.ropeResolutionCopiedBytes += buffer.size_bytes();
         uint8_t* stackLimit = std::bit_cast<uint8_t*>(vm.softStackLimit());
         resolveRopeInternalNoSubstring(buffer, stackLimit);
         convertToNonRope(function(newImpl.releaseNonNull()));
@@ -263,6 +269,7 @@ const String& JSRopeString::resolveRopeWithFunction(JSGlobalObject* nullOrGlobal
     }
     
     size_t sizeToReport = newImpl->cost();
+    vm.ropeResolutionCopiedBytes += buffer.size_bytes();
     uint8_t* stackLimit = std::bit_cast<uint8_t*>(vm.softStackLimit());
     resolveRopeInternalNoSubstring(buffer, stackLimit);
     convertToNonRope(function(newImpl.releaseNonNull()));
@@ -271,12 +278,79 @@ const String& JSRopeString::resolveRopeWithFunction(JSGlobalObject* nullOrGlobal
     return valueInternal();
 }
 
+// Loops like `result += piece; use(result);` resolve a rope whose first fiber is the string the previous
+// iteration resolved. Copying that prefix again on every iteration makes them quadratic. Once we see such a
+// chain, we resolve into a buffer with spare capacity, and make the result a substring of it. When the next
+// rope starts with exactly that result, we write the rest of it past the end of the result, into the spare
+// capacity, like StringBuilder would. No string can see that part of the buffer, since all the substrings
+// of it end at the length of the last result.
+template<typename CharacterType>
+bool JSRopeString::resolveRopeByAppending(VM& vm) const
+{
+    static constexpr unsigned minLengthForAppending = 1024;
+
+    ASSERT(isRope() && !isSubstring());
+    ASSERT(is8Bit() == std::is_same_v<CharacterType, LChar>);
+
+    unsigned length = this->length();
+    JSString* fiber0 = this->fiber0();
+    if (length < minLengthForAppending || fiber0->isRope())
+        return false;
+
+    StringImpl* prefix = fiber0->valueInternal().impl();
+    if (!prefix || prefix->is8Bit() != is8Bit())
+        return false;
+    unsigned prefixLength = prefix->length();
+
+    RefPtr<StringImpl>& buffer = vm.ropeAppendBuffer;
+    bool canAppend = buffer
+        && buffer->is8Bit() == is8Bit()
+        && prefix->isSubString()
+        && prefix->span<CharacterType>().data() == buffer->span<CharacterType>().data()
+        && prefixLength == vm.ropeAppendBufferLength
+        && length <= buffer->length();
+    size_t sizeToReport = 0;
+    if (!canAppend) {
+        if (prefix != vm.lastResolvedRopeImpl)
+            return false;
+
+        std::span<CharacterType> characters;
+        auto newBuffer = StringImpl::tryCreateUninitialized(std::min<size_t>(static_cast<size_t>(length) * 2, MaxLength), characters);
+        if (!newBuffer)
+            return false;
+        StringImpl::copyCharacters(characters, prefix->span<CharacterType>());
+        vm.ropeResolutionCopiedBytes += prefix->span<CharacterType>().size_bytes();
+        sizeToReport = newBuffer->cost();
+        buffer = WTFMove(newBuffer);
+    }
+
+    auto characters = spanConstCast<CharacterType>(buffer->span<CharacterType>()).subspan(prefixLength, length - prefixLength);
+    resolveToBuffer(fiber1(), fiber2(), nullptr, characters, std::bit_cast<uint8_t*>(vm.softStackLimit()));
+    vm.ropeResolutionCopiedBytes += characters.size_bytes();
+    vm.ropeAppendBufferLength = length;
+    convertToNonRope(StringImpl::createSubstringSharingImpl(*buffer, 0, length));
+    vm.heap.reportExtraMemoryAllocated(this, sizeToReport);
+    return true;
+}
+
 const String& JSRopeString::resolveRope(JSGlobalObject* nullOrGlobalObjectForOOM) const
 {
+    VM& vm = this->vm();
+    if (!isSubstring()) {
+        bool didAppend = is8Bit() ? resolveRopeByAppending<LChar>(vm) : resolveRopeByAppending<UChar>(vm);
+        if (didAppend) {
+            ++vm.ropeResolutionCount;
+            vm.lastResolvedRopeImpl = valueInternal().impl();
+            return valueInternal();
+        }
+    }
+
     constexpr bool reportAllocation = true;
-    return resolveRopeWithFunction<reportAllocation>(nullOrGlobalObjectForOOM, [] (Ref<StringImpl>&& newImpl) {
+    auto& result = resolveRopeWithFunction<reportAllocation>(nullOrGlobalObjectForOOM, [] (Ref<StringImpl>&& newImpl) {
         return WTFMove(newImpl);
     });
+    vm.lastResolvedRopeImpl = result.impl();
+    return result;
 }
 
 const String& JSRopeString::resolveRopeWithoutGC() const
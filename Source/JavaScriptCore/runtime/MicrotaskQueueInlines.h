@@ -65,7 +65,10 @@ inline void MicrotaskQueue::performMicrotaskCheckpoint(VM& vm, NOESCAPE const In
         }
         }
     }
-    m_queue.swap(m_toKeep);
+    // Suspended tasks are rare. Only swap when some were kept, so that m_queue stays the one queue that grows
+    // instead of both queues taking turns and each holding a ring buffer sized for the largest burst.
+    if (!m_toKeep.isEmpty())
+        m_queue.swap(m_toKeep);
 }
 
 
@@ -243,6 +243,7 @@ bool hasCapacityToUseLargeGigacage();
     v(Bool, useOSREntryToFTL, true, Normal, nullptr) \
     \
     v(Bool, useFTLJIT, true, Normal, "allows the FTL JIT to be used if true"_s) \
+    v(Double, ftlCompileTimeBudgetMs, 0, Normal, "abandons an FTL compilation, leaving the function in the DFG tier, once it has run for longer than this many milliseconds, checked between DFG, B3 and Air phases (0 disables the budget)"_s) \
     v(Bool, validateFTLOSRExitLiveness, false, Normal, nullptr) \
     v(Bool, poisonDeadOSRExitVariables, false, Normal, "Put 0xbad0beef into dead OSR exit values rather than jsUndefined"_s) \
     v(Unsigned, defaultB3OptLevel, 2, Normal, nullptr) \
@@ -497,6 +498,7 @@ bool hasCapacityToUseLargeGigacage();
     v(Unsigned, maxB3TailDupBlockSize, 3, Normal, nullptr) \
     v(Unsigned, maxB3TailDupBlockSuccessors, 3, Normal, nullptr) \
     v(Bool, useB3HoistLoopInvariantValues, true, Normal, nullptr) \
+    v(Bool, logB3LoopVectorizationCandidates, false, Normal, "logs which inner loops have the counted, unit-stride shape needed for vectorization and why the others do not"_s) \
     v(Bool, useB3CanonicalizePrePostIncrements, false, Normal, nullptr) \
     v(Bool, useAirOptimizePairedLoadStore, true, Normal, nullptr) \
     \
@@ -611,6 +613,7 @@ bool hasCapacityToUseLargeGigacage();
     v(Bool, useLLIntICs, true, Normal, "Use property and call ICs in LLInt code."_s) \
     v(Bool, useBaselineJITCodeSharing, is64Bit(), Normal, nullptr) \
     v(Bool, libpasScavengeContinuously, false, Normal, nullptr) \
+    v(Bool, useTransparentHugePages, false, Normal, "Back the structure heap and large libpas allocations with transparent huge pages on Linux"_s) \
     v(Unsigned, libpasForcePGMWithRate, 0, Normal, "Forces on probablistic guard malloc and guards allocations with a rate 1/N (0 is disabled)"_s) \
     v(Bool, useWasmFaultSignalHandler, true, Normal, nullptr) \
     v(Bool, dumpUnlinkedDFGValidation, false, Normal, nullptr) \
@@ -121,7 +121,11 @@ public:
     static constexpr uint8_t ChainOffset = Traits::EntrySize - 1;
 
     static constexpr uint8_t LoadFactor = 1;
-    static constexpr uint8_t InitialCapacity = 8;
+    static constexpr uint8_t InitialCapacity = 4;
+    // Tables up to this capacity are filled completely before growing. Their chains are at most this long,
+    // and walking a chain that short costs about as much as a linear scan, so there is no point in paying
+    // for twice the entries most small Maps and Sets ever hold.
+    static constexpr uint8_t CompactCapacity = 8;
     static constexpr TableSize LargeCapacity = 2 << 15;
 
     static_assert(EntrySize == MapTraits::EntrySize || EntrySize == SetTraits::EntrySize);
@@ -395,8 +399,13 @@ public:
 
         bool isSmallCapacity = capacity < LargeCapacity;
         TableSize expandFactor = isSmallCapacity ? 2 : 1;
+        if (capacity < CompactCapacity)
+            expandFactor = 1; // Stay compact: a full InitialCapacity table grows to CompactCapacity.
 
-        if (isSmallCapacity) {
+        if (capacity <= CompactCapacity) {
+            if (usedCapacity < capacity)
+                return &base;
+        } else if (isSmallCapacity) {
             if (usedCapacity < (capacity >> 1))
                 return &base;
         } else {
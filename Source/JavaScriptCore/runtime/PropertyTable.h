@@ -158,8 +158,9 @@ public:
     // Copy this PropertyTable, ensuring the copy has at least the capacity provided.
     PropertyTable* copy(VM&, unsigned newCapacity);
 
-#ifndef NDEBUG
     size_t sizeInMemory();
+
+#ifndef NDEBUG
     void checkConsistency();
 #endif
 
@@ -497,7 +498,6 @@ inline PropertyTable* PropertyTable::copy(VM& vm, unsigned newCapacity)
     return PropertyTable::clone(vm, newCapacity, *this);
 }
 
-#ifndef NDEBUG
 inline size_t PropertyTable::sizeInMemory()
 {
     size_t result = sizeof(PropertyTable) + dataSize(isCompact());
@@ -505,7 +505,6 @@ inline size_t PropertyTable::sizeInMemory()
         result += (m_deletedOffsets->capacity() * sizeof(PropertyOffset));
     return result;
 }
-#endif
 
 template<typename Index, typename Entry>
 inline void PropertyTable::reinsert(Index* indexVector, Entry* table, const ValueType& entry)
@@ -79,6 +79,11 @@ static ALWAYS_INLINE void arrayInsertionSort(VM& vm, std::span<ElementType> span
 template<typename ElementType, typename Functor>
 static ALWAYS_INLINE void mergePowersortRuns(VM& vm, std::span<ElementType> dst, std::span<const ElementType> src, size_t srcIndex1, size_t srcEnd1, size_t srcIndex2, size_t srcEnd2, const Functor& comparator)
 {
+    // After this many elements in a row from the same run, search for the end of the streak exponentially
+    // and copy it at once, like TimSort's galloping mode. Runs that barely interleave, like the pieces of
+    // reverse sorted input, then take a logarithmic number of comparisons to merge instead of a linear one.
+    constexpr unsigned minGallop = 7;
+
     auto scope = DECLARE_THROW_SCOPE(vm);
 
     size_t left = srcIndex1;
@@ -86,25 +91,114 @@ static ALWAYS_INLINE void mergePowersortRuns(VM& vm, std::span<ElementType> dst,
     size_t right = srcIndex2;
     size_t rightEnd = srcEnd2;
 
-    ASSERT(leftEnd <= right);
+    ASSERT(leftEnd == right);
     ASSERT(rightEnd <= src.size());
 
-    for (size_t dstIndex = left; dstIndex < rightEnd; ++dstIndex) {
-        if (right < rightEnd) {
-            if (left >= leftEnd) {
-                dst[dstIndex] = src[right++];
-                continue;
+    // Returns the first index in [begin, end) for which predicate is false. The predicate has to be true
+    // for a prefix of the range and false for the rest of it.
+    auto gallop = [&](size_t begin, size_t end, const auto& predicate) -> size_t {
+        size_t low = begin;
+        size_t high = end;
+        for (size_t step = 1; low < high; step *= 2) {
+            size_t probe = low + std::min(step, high - low) - 1;
+            bool result = predicate(probe);
+            RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, begin);
+            if (!result) {
+                high = probe;
+                break;
             }
-            bool result = comparator(src[right], src[left]);
+            low = probe + 1;
+        }
+        while (low < high) {
+            size_t middle = std::midpoint(low, high);
+            bool result = predicate(middle);
+            RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, begin);
+            if (result)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    };
+    auto takeLeftWhileNotGreaterThanRight = [&](size_t index) ALWAYS_INLINE_LAMBDA {
+        return !comparator(src[right], src[index]);
+    };
+    auto takeRightWhileLessThanLeft = [&](size_t index) ALWAYS_INLINE_LAMBDA {
+        return comparator(src[index], src[left]);
+    };
+
+    // The elements of the left run that are not greater than the first element of the right run are
+    // already in place, and starting out galloping on the left run skips over them. There is no need to
+    // do the same for the end of the right run: once the left run runs out, the rest of the right run is
+    // copied without any comparisons.
+    unsigned leftStreak = minGallop;
+    unsigned rightStreak = 0;
+    size_t dstIndex = left;
+    while (left < leftEnd && right < rightEnd) {
+        if (leftStreak >= minGallop) {
+            size_t leftStop = gallop(left, leftEnd, takeLeftWhileNotGreaterThanRight);
             RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, void());
-            if (result) {
-                dst[dstIndex] = src[right++];
-                continue;
-            }
+            WTF::copyElements(dst.subspan(dstIndex, leftStop - left), src.subspan(left, leftStop - left));
+            dstIndex += leftStop - left;
+            left = leftStop;
+            leftStreak = 0;
+            continue;
+        }
+        if (rightStreak >= minGallop) {
+            size_t rightStop = gallop(right, rightEnd, takeRightWhileLessThanLeft);
+            RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, void());
+            WTF::copyElements(dst.subspan(dstIndex, rightStop - right), src.subspan(right, rightStop - right));
+            dstIndex += rightStop - right;
+            right = rightStop;
+            rightStreak = 0;
+            continue;
         }
 
-        dst[dstIndex] = src[left++];
+        bool result = comparator(src[right], src[left]);
+        RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, void());
+        if (result) {
+            dst[dstIndex++] = src[right++];
+            ++rightStreak;
+            leftStreak = 0;
+        } else {
+            dst[dstIndex++] = src[left++];
+            ++leftStreak;
+            rightStreak = 0;
+        }
     }
+
+    WTF::copyElements(dst.subspan(dstIndex, leftEnd - left), src.subspan(left, leftEnd - left));
+    dstIndex += leftEnd - left;
+    WTF::copyElements(dst.subspan(dstIndex, rightEnd - right), src.subspan(right, rightEnd - right));
+}
+
+// Returns the index of the last element of the run starting at {begin}. A strictly descending run is
+// reversed in place, so that reverse sorted input costs a single pass. It has to be strictly descending,
+// since reversing equal elements would make the sort unstable.
+template<typename ElementType, typename Functor>
+static ALWAYS_INLINE size_t extendRunRight(VM& vm, std::span<ElementType> span, size_t begin, const Functor& comparator)
+{
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    size_t end = begin;
+    if (end + 1 >= span.size())
+        return end;
+
+    bool descending = comparator(span[end + 1], span[end]);
+    RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, end);
+    ++end;
+
+    while (end + 1 < span.size()) {
+        bool result = comparator(span[end + 1], span[end]);
+        RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, end);
+        if (result != descending)
+            break;
+        ++end;
+    }
+
+    if (descending)
+        std::ranges::reverse(span.subspan(begin, end + 1 - begin));
+    return end;
 }
 
 // J. Ian Munro and Sebastian Wild. Nearly-Optimal Mergesorts: Fast, Practical Sorting Methods That
@@ -168,16 +262,8 @@ static ALWAYS_INLINE std::span<ElementType> arrayStableSort(VM& vm, std::span<El
     // floor(lg(n)) + 1
     powerstack.reserveCapacity(8 * sizeof(numElements) - WTF::clz(numElements));
 
-    SortedRun run1 { 0, 0 };
-
-    // ExtendRunRight(run1.start, n)
-    while (run1.m_end + 1 < numElements) {
-        bool result = comparator(from[run1.m_end + 1], from[run1.m_end]);
-        RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, src);
-        if (result)
-            break;
-        ++run1.m_end;
-    }
+    SortedRun run1 { 0, extendRunRight(vm, from, 0, comparator) };
+    RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, src);
 
     if (run1.m_end - run1.m_begin < extendRunCutoff) {
         // If the run is too short, insertion sort a bit
@@ -197,16 +283,8 @@ static ALWAYS_INLINE std::span<ElementType> arrayStableSort(VM& vm, std::span<El
     }
 
     while (run1.m_end + 1 < numElements) {
-        SortedRun run2 { run1.m_end + 1, run1.m_end + 1 };
-
-        // ExtendRunRight(run2.start, n)
-        while (run2.m_end + 1 < numElements) {
-            bool result = comparator(from[run2.m_end + 1], from[run2.m_end]);
-            RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, src);
-            if (result)
-                break;
-            ++run2.m_end;
-        }
+        SortedRun run2 { run1.m_end + 1, extendRunRight(vm, from, run1.m_end + 1, comparator) };
+        RETURN_IF_EXCEPTION_WITH_TRAPS_DEFERRED(scope, src);
 
         if (run2.m_end - run2.m_begin < extendRunCutoff) {
             // If the run is too short, insertion sort a bit
@@ -531,6 +531,14 @@ public:
     Vector<unsigned> stringSplitIndice;
     StringReplaceCache stringReplaceCache;
 
+    // See JSRopeString::resolveRopeByAppending(). lastResolvedRopeImpl is only ever compared against, never
+    // dereferenced, so it does not need to keep the string alive.
+    RefPtr<StringImpl> ropeAppendBuffer;
+    unsigned ropeAppendBufferLength { 0 };
+    const StringImpl* lastResolvedRopeImpl { nullptr };
+    uint64_t ropeResolutionCount { 0 };
+    uint64_t ropeResolutionCopiedBytes { 0 };
+
     bool mightBeExecutingTaintedCode() const { return m_mightBeExecutingTaintedCode; }
     bool* addressOfMightBeExecutingTaintedCode() { return &m_mightBeExecutingTaintedCode; }
     void setMightBeExecutingTaintedCode(bool value = true) { m_mightBeExecutingTaintedCode = value; }
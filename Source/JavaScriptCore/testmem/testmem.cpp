@@ -40,11 +40,89 @@
 #include <memory-extra/showmap.h>
 #endif
 
+#if OS(LINUX)
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 static void description()
 {
     printf("usage \n testmem <path-to-file-to-run> [iterations]\n");
 }
 
+#if OS(LINUX)
+// Returns the value of a "Name: value kB" line of a /proc file, in bytes.
+static std::optional<uint64_t> readProcKilobytes(const char* path, const char* name)
+{
+    FILE* file = fopen(path, "r");
+    if (!file)
+        return std::nullopt;
+
+    std::optional<uint64_t> result;
+    size_t nameLength = strlen(name);
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        unsigned long long kilobytes;
+        if (!strncmp(line, name, nameLength) && line[nameLength] == ':' && sscanf(line + nameLength + 1, "%llu", &kilobytes) == 1) {
+            result = static_cast<uint64_t>(kilobytes) * 1024;
+            break;
+        }
+    }
+    fclose(file);
+    return result;
+}
+
+// Counts data TLB load misses of this process, which is what huge pages are meant to reduce. perf
+// events are often unavailable (containers, perf_event_paranoid), in which case nothing is reported.
+class DTLBMissCounter {
+public:
+    DTLBMissCounter()
+    {
+        struct perf_event_attr attributes;
+        memset(&attributes, 0, sizeof(attributes));
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.inherit = 1;
+        m_fd = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+
+    ~DTLBMissCounter()
+    {
+        if (m_fd >= 0)
+            close(m_fd);
+    }
+
+    void start()
+    {
+        if (m_fd < 0)
+            return;
+        ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    std::optional<uint64_t> stop()
+    {
+        if (m_fd < 0)
+            return std::nullopt;
+        ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t count;
+        if (read(m_fd, &count, sizeof(count)) != sizeof(count))
+            return std::nullopt;
+        return count;
+    }
+
+private:
+    int m_fd { -1 };
+};
+#endif
+
 struct Footprint {
     uint64_t current;
     uint64_t peak;
@@ -59,6 +137,12 @@ struct Footprint {
             static_cast<uint64_t>(entry->rss),
             static_cast<uint64_t>(entry->vss)
         };
+#elif OS(LINUX)
+        auto current = readProcKilobytes("/proc/self/status", "VmRSS");
+        auto peak = readProcKilobytes("/proc/self/status", "VmHWM");
+        if (!current || !peak)
+            return std::nullopt;
+        return Footprint { *current, *peak };
 #else
 #error "No testmem implementation for this platform."
 #endif
@@ -109,6 +193,10 @@ int main(int argc, char* argv[])
 
     auto sourceURL = JSStringCreateWithUTF8CString(path);
 
+#if OS(LINUX)
+    DTLBMissCounter dtlbMissCounter;
+    dtlbMissCounter.start();
+#endif
     auto startTime = MonotonicTime::now();
     JSContextGroupRef group = JSContextGroupCreate();
     for (size_t i = 0; i < iterations; ++i) {
@@ -123,10 +211,20 @@ int main(int argc, char* argv[])
     }
 
     auto time = MonotonicTime::now() - startTime;
+#if OS(LINUX)
+    auto dtlbMisses = dtlbMissCounter.stop();
+#endif
     if (auto footprint = Footprint::now()) {
         printf("time: %lf\n", time.seconds()); // Seconds
         printf("peak footprint: %" PRIu64 "\n", footprint->peak); // Bytes
         printf("footprint at end: %" PRIu64 "\n", footprint->current); // Bytes
+#if OS(LINUX)
+        // Run with JSC_useTransparentHugePages=true to compare against huge page backing.
+        if (auto hugePages = readProcKilobytes("/proc/self/smaps_rollup", "AnonHugePages"))
+            printf("huge pages at end: %" PRIu64 "\n", *hugePages); // Bytes
+        if (dtlbMisses)
+            printf("dTLB load misses: %" PRIu64 "\n", *dtlbMisses);
+#endif
     } else {
         printf("Failure when calling rusage\n");
         exit(1);
@@ -61,16 +61,35 @@ WTF_ALLOW_UNSAFE_BUFFER_USAGE_END
         return duration;
     }
 
+    void addBudgetOverrun(const char* compilerName, const char* name)
+    {
+        Locker locker { lock };
+
+        for (auto& tuple : budgetOverruns) {
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_BEGIN
+            if (!strcmp(std::get<0>(tuple), compilerName) && !strcmp(std::get<1>(tuple), name)) {
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_END
+                std::get<2>(tuple)++;
+                return;
+            }
+        }
+
+        budgetOverruns.append({ compilerName, name, 1 });
+    }
+
     void logTotals()
     {
         for (auto& tuple : totals) {
             dataLogLn(
                 "total ms: ", FixedWidthDouble(std::get<2>(tuple).milliseconds(), 8, 3), " max ms: ", FixedWidthDouble(std::get<3>(tuple).milliseconds(), 7, 3), " [", std::get<0>(tuple), "] ", std::get<1>(tuple));
         }
+        for (auto& tuple : budgetOverruns)
+            dataLogLn("budget overruns: ", std::get<2>(tuple), " [", std::get<0>(tuple), "] after ", std::get<1>(tuple));
     }
     
 private:
     Vector<std::tuple<const char*, const char*, Seconds, Seconds>> totals;
+    Vector<std::tuple<const char*, const char*, unsigned>> budgetOverruns;
     Lock lock;
 };
 
@@ -106,6 +125,11 @@ CompilerTimingScope::~CompilerTimingScope()
     }
 }
 
+void recordCompileTimeBudgetOverrun(ASCIILiteral compilerName, ASCIILiteral phaseName)
+{
+    compilerTimingScopeState().addBudgetOverrun(compilerName, phaseName);
+}
+
 void logTotalPhaseTimes()
 {
     compilerTimingScopeState().logTotals();
@@ -48,6 +48,10 @@ private:
     MonotonicTime m_before;
 };
 
+// Records that a compilation was abandoned at the given phase because it ran out of its
+// compile-time budget. Overruns are reported together with the phase totals.
+void recordCompileTimeBudgetOverrun(ASCIILiteral compilerName, ASCIILiteral phaseName);
+
 JS_EXPORT_PRIVATE void logTotalPhaseTimes();
 
 } // namespace JSC
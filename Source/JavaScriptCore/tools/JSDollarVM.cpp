@@ -40,6 +40,8 @@
 #include "FrameTracers.h"
 #include "FunctionCodeBlock.h"
 #include "GetterSetter.h"
+#include "HeapIterationScope.h"
+#include "IntlCache.h"
 #include "InterpreterInlines.h"
 #include "JITSizeStatistics.h"
 #include "JSArray.h"
@@ -49,15 +51,18 @@
 #include "JSPromise.h"
 #include "JSString.h"
 #include "LinkBuffer.h"
+#include "MarkedSpaceInlines.h"
 #include "NativeCallee.h"
 #include "OperationResult.h"
 #include "Options.h"
 #include "Parser.h"
 #include "ProbeContext.h"
+#include "PropertyTable.h"
 #include "ShadowChicken.h"
 #include "Snippet.h"
 #include "SnippetParams.h"
 #include "Strong.h"
+#include "StructureRareData.h"
 #include "TypeProfiler.h"
 #include "TypeProfilerLog.h"
 #include "VMEntryScopeInlines.h"
@@ -2226,6 +2231,11 @@ static JSC_DECLARE_HOST_FUNCTION(functionCreateCustomTestGetterSetter);
 static JSC_DECLARE_HOST_FUNCTION(functionDeltaBetweenButterflies);
 static JSC_DECLARE_HOST_FUNCTION(functionCurrentCPUTime);
 static JSC_DECLARE_HOST_FUNCTION(functionTotalGCTime);
+static JSC_DECLARE_HOST_FUNCTION(functionStructureHeapBreakdown);
+static JSC_DECLARE_HOST_FUNCTION(functionRopeResolutionStats);
+static JSC_DECLARE_HOST_FUNCTION(functionClearRopeResolutionStats);
+static JSC_DECLARE_HOST_FUNCTION(functionIntlCacheStats);
+static JSC_DECLARE_HOST_FUNCTION(functionClearIntlCacheStats);
 static JSC_DECLARE_HOST_FUNCTION(functionParseCount);
 static JSC_DECLARE_HOST_FUNCTION(functionIsWasmSupported);
 static JSC_DECLARE_HOST_FUNCTION(functionMake16BitStringIfPossible);
@@ -3812,6 +3822,124 @@ JSC_DEFINE_HOST_FUNCTION(functionTotalGCTime, (JSGlobalObject* globalObject, Cal
     return JSValue::encode(jsNumber(vm.heap.totalGCTime().seconds()));
 }
 
+// Reports how much of the heap is spent on Structures and their side tables.
+// Usage: var breakdown = $vm.structureHeapBreakdown();
+// Property tables that are neither pinned nor protected are dropped by the next GC, so
+// comparing the result before and after gc() shows how much of that memory is transient.
+JSC_DEFINE_HOST_FUNCTION(functionStructureHeapBreakdown, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    size_t structureCount = 0;
+    size_t structureBytes = 0;
+    size_t dictionaryStructureCount = 0;
+    size_t rareDataCount = 0;
+    size_t rareDataBytes = 0;
+    size_t propertyTableCount = 0;
+    size_t propertyTableBytes = 0;
+    size_t pinnedPropertyTableCount = 0;
+    size_t pinnedPropertyTableBytes = 0;
+    {
+        HeapIterationScope iterationScope(vm.heap);
+        vm.heap.objectSpace().forEachLiveCell(iterationScope, [&] (HeapCell* heapCell, HeapCell::Kind kind) {
+            if (!isJSCellKind(kind))
+                return IterationStatus::Continue;
+            auto* cell = static_cast<JSCell*>(heapCell);
+            if (auto* structure = jsDynamicCast<Structure*>(cell)) {
+                structureCount++;
+                structureBytes += structure->cellSize();
+                if (structure->isDictionary())
+                    dictionaryStructureCount++;
+                if (structure->isPinnedPropertyTable()) {
+                    if (PropertyTable* table = structure->propertyTableOrNull()) {
+                        pinnedPropertyTableCount++;
+                        pinnedPropertyTableBytes += table->sizeInMemory();
+                    }
+                }
+            } else if (auto* rareData = jsDynamicCast<StructureRareData*>(cell)) {
+                rareDataCount++;
+                rareDataBytes += rareData->cellSize();
+            } else if (auto* table = jsDynamicCast<PropertyTable*>(cell)) {
+                propertyTableCount++;
+                propertyTableBytes += table->sizeInMemory();
+            }
+            return IterationStatus::Continue;
+        });
+    }
+
+    JSObject* result = constructEmptyObject(globalObject);
+    RETURN_IF_EXCEPTION(scope, { });
+    auto put = [&] (ASCIILiteral name, size_t value) {
+        result->putDirect(vm, Identifier::fromString(vm, name), jsNumber(value));
+    };
+    put("structureCount"_s, structureCount);
+    put("structureBytes"_s, structureBytes);
+    put("dictionaryStructureCount"_s, dictionaryStructureCount);
+    put("structureRareDataCount"_s, rareDataCount);
+    put("structureRareDataBytes"_s, rareDataBytes);
+    put("propertyTableCount"_s, propertyTableCount);
+    put("propertyTableBytes"_s, propertyTableBytes);
+    put("pinnedPropertyTableCount"_s, pinnedPropertyTableCount);
+    put("pinnedPropertyTableBytes"_s, pinnedPropertyTableBytes);
+    put("discardablePropertyTableBytes"_s, propertyTableBytes - std::min(propertyTableBytes, pinnedPropertyTableBytes));
+    put("totalBytes"_s, structureBytes + rareDataBytes + propertyTableBytes);
+    return JSValue::encode(result);
+}
+
+// Reports how many ropes have been resolved, and how many bytes of characters that copied.
+// Usage: var stats = $vm.ropeResolutionStats();
+JSC_DEFINE_HOST_FUNCTION(functionRopeResolutionStats, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSObject* result = constructEmptyObject(globalObject);
+    RETURN_IF_EXCEPTION(scope, { });
+    result->putDirect(vm, Identifier::fromString(vm, "resolutions"_s), jsNumber(vm.ropeResolutionCount));
+    result->putDirect(vm, Identifier::fromString(vm, "copiedBytes"_s), jsNumber(vm.ropeResolutionCopiedBytes));
+    return JSValue::encode(result);
+}
+
+// Resets the counters reported by $vm.ropeResolutionStats().
+// Usage: $vm.clearRopeResolutionStats()
+JSC_DEFINE_HOST_FUNCTION(functionClearRopeResolutionStats, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    vm.ropeResolutionCount = 0;
+    vm.ropeResolutionCopiedBytes = 0;
+    return JSValue::encode(jsUndefined());
+}
+
+// Reports how often ICU date and number formatters were served from the VM's IntlCache instead of being opened.
+// Usage: var stats = $vm.intlCacheStats();
+JSC_DEFINE_HOST_FUNCTION(functionIntlCacheStats, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSObject* result = constructEmptyObject(globalObject);
+    RETURN_IF_EXCEPTION(scope, { });
+    result->putDirect(vm, Identifier::fromString(vm, "dateFormatHits"_s), jsNumber(vm.intlCache().dateFormatCacheHits()));
+    result->putDirect(vm, Identifier::fromString(vm, "dateFormatMisses"_s), jsNumber(vm.intlCache().dateFormatCacheMisses()));
+    result->putDirect(vm, Identifier::fromString(vm, "numberFormatHits"_s), jsNumber(vm.intlCache().numberFormatCacheHits()));
+    result->putDirect(vm, Identifier::fromString(vm, "numberFormatMisses"_s), jsNumber(vm.intlCache().numberFormatCacheMisses()));
+    return JSValue::encode(result);
+}
+
+// Resets the counters reported by $vm.intlCacheStats().
+// Usage: $vm.clearIntlCacheStats()
+JSC_DEFINE_HOST_FUNCTION(functionClearIntlCacheStats, (JSGlobalObject* globalObject, CallFrame*))
+{
+    DollarVMAssertScope assertScope;
+    globalObject->vm().intlCache().clearCacheStatistics();
+    return JSValue::encode(jsUndefined());
+}
+
 JSC_DEFINE_HOST_FUNCTION(functionParseCount, (JSGlobalObject*, CallFrame*))
 {
     DollarVMAssertScope assertScope;
@@ -4439,6 +4567,11 @@ void JSDollarVM::finishCreation(VM& vm)
     
     addFunction(vm, "currentCPUTime"_s, functionCurrentCPUTime, 0);
     addFunction(vm, "totalGCTime"_s, functionTotalGCTime, 0);
+    addFunction(vm, "structureHeapBreakdown"_s, functionStructureHeapBreakdown, 0);
+    addFunction(vm, "ropeResolutionStats"_s, functionRopeResolutionStats, 0);
+    addFunction(vm, "clearRopeResolutionStats"_s, functionClearRopeResolutionStats, 0);
+    addFunction(vm, "intlCacheStats"_s, functionIntlCacheStats, 0);
+    addFunction(vm, "clearIntlCacheStats"_s, functionClearIntlCacheStats, 0);
 
     addFunction(vm, "parseCount"_s, functionParseCount, 0);
 
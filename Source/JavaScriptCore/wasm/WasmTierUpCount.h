@@ -111,6 +111,7 @@ public:
             optimizeNextInvocation(functionIndex);
             return;
         case CompilationFailed:
+        case CompilationOverBudget:
             dontOptimizeAnytimeSoon(functionIndex);
             return;
         case CompilationDeferred:
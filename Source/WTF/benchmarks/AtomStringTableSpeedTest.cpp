@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// On Mac, you can build this like so:
+// xcrun clang++ -o AtomStringTableSpeedTest Source/WTF/benchmarks/AtomStringTableSpeedTest.cpp -O3 -W -ISource/WTF -ISource/WTF/icu -LWebKitBuild/Release -lWTF -framework Foundation -licucore -std=c++2b -fvisibility=hidden -DNDEBUG=1
+
+#include "config.h"
+
+#include <wtf/HashSet.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+#include <wtf/text/AtomString.h>
+#include <wtf/text/AtomStringTable.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/MakeString.h>
+
+namespace {
+
+unsigned numThreads;
+unsigned numKeys;
+unsigned numIterations;
+
+[[noreturn]] void usage()
+{
+    printf("Usage: AtomStringTableSpeedTest per-thread|concurrent|all <num threads> <num keys> <num iterations>\n");
+    exit(1);
+}
+
+// Models workers parsing the same JSON documents: every thread atomizes the same property names from raw
+// characters, which is what the JSON parser does for object keys.
+void runBenchmark(const char* name, bool useConcurrentTable, const Vector<CString>& keys)
+{
+    Lock lock;
+    HashSet<StringImpl*> uniqueAtoms;
+    Vector<Vector<AtomString>> atomsPerThread(numThreads);
+    Vector<Ref<Thread>> threads;
+
+    MonotonicTime before = MonotonicTime::now();
+    for (unsigned threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+        threads.append(Thread::create("AtomStringTableSpeedTest worker"_s, [&, threadIndex] {
+            if (useConcurrentTable)
+                Thread::currentSingleton().setCurrentAtomStringTable(&AtomStringTable::concurrent());
+
+            Vector<AtomString> atoms;
+            for (unsigned iteration = 0; iteration < numIterations; ++iteration) {
+                atoms.shrink(0);
+                for (auto& key : keys)
+                    atoms.append(AtomString(byteCast<LChar>(key.span())));
+            }
+
+            Locker locker { lock };
+            for (auto& atom : atoms)
+                uniqueAtoms.add(atom.impl());
+            // Keep per-thread atoms alive until all workers are done, so that they are all counted.
+            atomsPerThread[threadIndex] = WTFMove(atoms);
+        }));
+    }
+    for (auto& thread : threads)
+        thread->waitForCompletion();
+    MonotonicTime after = MonotonicTime::now();
+
+    size_t bytes = 0;
+    for (auto* atom : uniqueAtoms)
+        bytes += sizeof(StringImpl) + atom->length();
+
+    double operations = static_cast<double>(numThreads) * numIterations * keys.size();
+    printf("%s: %.2lf ns per atomization (%.2lf M/s), %u unique atoms, %zu bytes of atoms.\n", name,
+        (after - before).nanoseconds() / operations, operations / (after - before).microseconds(), uniqueAtoms.size(), bytes);
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    WTF::initialize();
+
+    if (argc != 5
+        || sscanf(argv[2], "%u", &numThreads) != 1
+        || sscanf(argv[3], "%u", &numKeys) != 1
+        || sscanf(argv[4], "%u", &numIterations) != 1
+        || !numThreads
+        || !numKeys
+        || !numIterations)
+        usage();
+
+    Vector<CString> keys;
+    for (unsigned i = 0; i < numKeys; ++i)
+        keys.append(makeString("propertyName"_s, i).utf8());
+
+    bool didRun = false;
+    if (!strcmp(argv[1], "per-thread") || !strcmp(argv[1], "all")) {
+        runBenchmark("per-thread", false, keys);
+        didRun = true;
+    }
+    if (!strcmp(argv[1], "concurrent") || !strcmp(argv[1], "all")) {
+        runBenchmark("concurrent", true, keys);
+        didRun = true;
+    }
+
+    if (!didRun)
+        usage();
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// On Mac, you can build this like so:
+// xcrun clang++ -o HashMapSpeedTest Source/WTF/benchmarks/HashMapSpeedTest.cpp -O3 -W -ISource/WTF -ISource/WTF/icu -LWebKitBuild/Release -lWTF -framework Foundation -licucore -std=c++2b -fvisibility=hidden -DNDEBUG=1
+
+#include "config.h"
+
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/RobinHoodHashMap.h>
+#include <wtf/SwissHashMap.h>
+#include <wtf/Vector.h>
+#include <wtf/WeakRandom.h>
+#include <wtf/Threading.h>
+#include <wtf/text/MakeString.h>
+
+namespace {
+
+unsigned numKeys;
+unsigned numIterations;
+
+[[noreturn]] void usage()
+{
+    printf("Usage: HashMapSpeedTest int|string|all <num keys> <num iterations>\n");
+    exit(1);
+}
+
+// Keeps the optimizer from dropping lookups whose results are otherwise unused.
+volatile unsigned sink;
+
+template<typename MapType>
+size_t bytesPerEntry(const MapType& map, size_t metadataPerBucket)
+{
+    using Bucket = KeyValuePair<typename MapType::KeyType, typename MapType::MappedType>;
+    if (map.isEmpty())
+        return 0;
+    return map.capacity() * (sizeof(Bucket) + metadataPerBucket) / map.size();
+}
+
+template<typename MapType, typename KeyType>
+void runBenchmark(const char* name, const Vector<KeyType>& keys, const Vector<KeyType>& missingKeys, size_t metadataPerBucket)
+{
+    Seconds insertTime;
+    Seconds hitTime;
+    Seconds missTime;
+    Seconds eraseTime;
+    size_t bytes = 0;
+
+    for (unsigned iteration = 0; iteration < numIterations; ++iteration) {
+        MapType map;
+
+        MonotonicTime before = MonotonicTime::now();
+        for (unsigned i = 0; i < keys.size(); ++i)
+            map.add(keys[i], i);
+        MonotonicTime afterInsert = MonotonicTime::now();
+
+        unsigned found = 0;
+        for (auto& key : keys)
+            found += map.contains(key);
+        MonotonicTime afterHit = MonotonicTime::now();
+
+        for (auto& key : missingKeys)
+            found += map.contains(key);
+        MonotonicTime afterMiss = MonotonicTime::now();
+
+        bytes = bytesPerEntry(map, metadataPerBucket);
+
+        for (auto& key : keys)
+            map.remove(key);
+        MonotonicTime afterErase = MonotonicTime::now();
+
+        RELEASE_ASSERT(found == keys.size());
+        RELEASE_ASSERT(map.isEmpty());
+        sink = found;
+
+        insertTime += afterInsert - before;
+        hitTime += afterHit - afterInsert;
+        missTime += afterMiss - afterHit;
+        eraseTime += afterErase - afterMiss;
+    }
+
+    auto nanosecondsPerOperation = [&](Seconds time) {
+        return time.nanoseconds() / (static_cast<double>(numIterations) * keys.size());
+    };
+    printf("%s: insert %.2lf ns, hit %.2lf ns, miss %.2lf ns, erase %.2lf ns, %zu bytes/entry.\n", name,
+        nanosecondsPerOperation(insertTime), nanosecondsPerOperation(hitTime), nanosecondsPerOperation(missTime), nanosecondsPerOperation(eraseTime), bytes);
+}
+
+void runIntegerBenchmarks()
+{
+    WeakRandom random(42);
+    HashSet<unsigned> seen;
+    Vector<unsigned> keys;
+    Vector<unsigned> missingKeys;
+    while (keys.size() < numKeys) {
+        unsigned key = random.getUint32();
+        if (key && key != std::numeric_limits<unsigned>::max() && seen.add(key).isNewEntry)
+            keys.append(key);
+    }
+    while (missingKeys.size() < numKeys) {
+        unsigned key = random.getUint32();
+        if (key && key != std::numeric_limits<unsigned>::max() && seen.add(key).isNewEntry)
+            missingKeys.append(key);
+    }
+
+    // RobinHoodHashTable requires keys which cache their hash, so it is only measured with strings.
+    runBenchmark<HashMap<unsigned, unsigned>>("HashMap<unsigned>", keys, missingKeys, 0);
+    runBenchmark<SwissHashMap<unsigned, unsigned>>("SwissHashMap<unsigned>", keys, missingKeys, 1);
+}
+
+void runStringBenchmarks()
+{
+    Vector<String> keys;
+    Vector<String> missingKeys;
+    for (unsigned i = 0; i < numKeys; ++i) {
+        keys.append(makeString("key"_s, i));
+        missingKeys.append(makeString("missing"_s, i));
+    }
+
+    runBenchmark<HashMap<String, unsigned>>("HashMap<String>", keys, missingKeys, 0);
+    runBenchmark<FastRobinHoodHashMap<String, unsigned>>("FastRobinHoodHashMap<String>", keys, missingKeys, 0);
+    runBenchmark<MemoryCompactRobinHoodHashMap<String, unsigned>>("MemoryCompactRobinHoodHashMap<String>", keys, missingKeys, 0);
+    runBenchmark<SwissHashMap<String, unsigned>>("SwissHashMap<String>", keys, missingKeys, 1);
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    WTF::initialize();
+
+    if (argc != 4
+        || sscanf(argv[2], "%u", &numKeys) != 1
+        || sscanf(argv[3], "%u", &numIterations) != 1
+        || !numKeys
+        || !numIterations)
+        usage();
+
+    bool didRun = false;
+    if (!strcmp(argv[1], "int") || !strcmp(argv[1], "all")) {
+        runIntegerBenchmarks();
+        didRun = true;
+    }
+    if (!strcmp(argv[1], "string") || !strcmp(argv[1], "all")) {
+        runStringBenchmarks();
+        didRun = true;
+    }
+
+    if (!didRun)
+        usage();
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// On Mac, you can build this like so:
+// xcrun clang++ -o ParallelAlgorithmsSpeedTest Source/WTF/benchmarks/ParallelAlgorithmsSpeedTest.cpp -O3 -W -ISource/WTF -ISource/WTF/icu -LWebKitBuild/Release -lWTF -framework Foundation -licucore -std=c++2b -fvisibility=hidden -DNDEBUG=1
+
+#include "config.h"
+
+#include <algorithm>
+#include <cmath>
+#include <wtf/MonotonicTime.h>
+#include <wtf/ParallelAlgorithms.h>
+#include <wtf/ParallelHelperPool.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+#include <wtf/WeakRandom.h>
+
+namespace {
+
+unsigned numElements;
+unsigned numIterations;
+size_t grainSize;
+
+[[noreturn]] void usage()
+{
+    printf("Usage: ParallelAlgorithmsSpeedTest for|reduce|sort|all <num elements> <num iterations> [<grain size>]\n");
+    exit(1);
+}
+
+// Keeps the optimizer from dropping results that are otherwise unused.
+volatile double sink;
+
+// Stands in for per-pixel filter work: a little arithmetic per element, with no sharing between elements.
+inline double work(double value)
+{
+    return std::sqrt(value) * std::sin(value);
+}
+
+template<typename Functor>
+double measure(const Functor& functor)
+{
+    MonotonicTime before = MonotonicTime::now();
+    for (unsigned iteration = 0; iteration < numIterations; ++iteration)
+        functor();
+    return (MonotonicTime::now() - before).milliseconds() / numIterations;
+}
+
+void report(const char* name, double serialMilliseconds, double parallelMilliseconds)
+{
+    printf("%s: serial %.3lf ms, parallel %.3lf ms, speedup %.2lfx\n", name, serialMilliseconds, parallelMilliseconds, serialMilliseconds / parallelMilliseconds);
+}
+
+void benchmarkFor(const Vector<double>& input)
+{
+    Vector<double> output(input.size());
+    double serial = measure([&] {
+        for (size_t i = 0; i < input.size(); ++i)
+            output[i] = work(input[i]);
+    });
+    double parallel = measure([&] {
+        parallelFor(0, input.size(), grainSize, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                output[i] = work(input[i]);
+        });
+    });
+    sink = output.last();
+    report("parallelFor", serial, parallel);
+}
+
+void benchmarkReduce(const Vector<double>& input)
+{
+    double serial = measure([&] {
+        double sum = 0;
+        for (double value : input)
+            sum += work(value);
+        sink = sum;
+    });
+    double parallel = measure([&] {
+        sink = parallelReduce(0, input.size(), grainSize, 0.0, [&](size_t begin, size_t end) {
+            double sum = 0;
+            for (size_t i = begin; i < end; ++i)
+                sum += work(input[i]);
+            return sum;
+        }, std::plus<> { });
+    });
+    report("parallelReduce", serial, parallel);
+}
+
+void benchmarkSort(const Vector<double>& input)
+{
+    Vector<double> data;
+    auto sortTime = [&](const auto& sort) {
+        double total = 0;
+        for (unsigned iteration = 0; iteration < numIterations; ++iteration) {
+            data = input;
+            MonotonicTime before = MonotonicTime::now();
+            sort();
+            total += (MonotonicTime::now() - before).milliseconds();
+            RELEASE_ASSERT(std::is_sorted(data.begin(), data.end()));
+        }
+        return total / numIterations;
+    };
+    double serial = sortTime([&] {
+        std::sort(data.begin(), data.end());
+    });
+    double parallel = sortTime([&] {
+        parallelSort(data.mutableSpan(), std::less<> { }, grainSize);
+    });
+    report("parallelSort", serial, parallel);
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    WTF::initialize();
+
+    if ((argc != 4 && argc != 5)
+        || sscanf(argv[2], "%u", &numElements) != 1
+        || sscanf(argv[3], "%u", &numIterations) != 1
+        || (argc == 5 && sscanf(argv[4], "%zu", &grainSize) != 1)
+        || !numElements
+        || !numIterations)
+        usage();
+
+    WeakRandom random;
+    Vector<double> input(numElements, [&](size_t) {
+        return random.get() * 1000;
+    });
+
+    printf("%u helper threads, grain size %zu.\n", parallelAlgorithmsPool().numberOfThreads(), parallelGrainSize(numElements, grainSize));
+
+    bool didRun = false;
+    if (!strcmp(argv[1], "for") || !strcmp(argv[1], "all")) {
+        benchmarkFor(input);
+        didRun = true;
+    }
+    if (!strcmp(argv[1], "reduce") || !strcmp(argv[1], "all")) {
+        benchmarkReduce(input);
+        didRun = true;
+    }
+    if (!strcmp(argv[1], "sort") || !strcmp(argv[1], "all")) {
+        benchmarkSort(input);
+        didRun = true;
+    }
+
+    if (!didRun)
+        usage();
+
+    return 0;
+}
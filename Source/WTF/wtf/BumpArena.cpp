@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include <wtf/BumpArena.h>
+
+#include <wtf/MathExtras.h>
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_BEGIN
+
+namespace WTF {
+
+static thread_local BumpArena::Scope* currentScope;
+
+BumpArena::Scope::Scope(BumpArena& arena)
+    : m_arena(arena)
+    , m_previous(currentScope)
+{
+    if (!arena.m_scopeDepth++) {
+        if (!arena.m_pool)
+            arena.m_pool = arena.m_allocator.startAllocator(arena.m_maxCapacity);
+        if (arena.m_pool)
+            m_position = arena.m_pool->position();
+    }
+    currentScope = this;
+}
+
+BumpArena::Scope::~Scope()
+{
+    ASSERT(currentScope == this);
+    currentScope = m_previous;
+    if (--m_arena.m_scopeDepth)
+        return;
+    if (m_position)
+        m_arena.m_pool = m_arena.m_pool->dealloc(m_position);
+    m_arena.m_lastAllocation = nullptr;
+}
+
+void* BumpArena::tryAllocate(size_t size)
+{
+    ASSERT(m_scopeDepth);
+    if (!m_pool || size > m_maxCapacity)
+        return nullptr;
+
+    size_t allocationSize = roundUpToMultipleOf<alignment>(size);
+    BumpPointerPool* pool = m_pool->ensureCapacity(sizeof(Header) + allocationSize);
+    if (!pool)
+        return nullptr;
+    m_pool = pool;
+
+    auto* header = static_cast<Header*>(pool->alloc(sizeof(Header) + allocationSize));
+    header->size = allocationSize;
+    m_lastAllocation = header;
+    return header + 1;
+}
+
+void* BumpArena::tryReallocate(void* pointer, size_t newSize)
+{
+    ASSERT(contains(pointer));
+    Header* header = headerFor(pointer);
+    size_t oldSize = header->size;
+
+    if (header == m_lastAllocation && newSize <= m_maxCapacity) {
+        // Vectors grow by reallocating their buffer, and the one being grown is usually the last thing that
+        // was allocated, so try to extend it where it is.
+        size_t allocationSize = roundUpToMultipleOf<alignment>(newSize);
+        m_pool = m_pool->dealloc(header);
+        BumpPointerPool* pool = m_pool->ensureCapacity(sizeof(Header) + allocationSize);
+        if (pool == m_pool) {
+            pool->alloc(sizeof(Header) + allocationSize);
+            header->size = allocationSize;
+            return pointer;
+        }
+        // It does not fit in this pool. Nothing has overwritten the old allocation, so take it back.
+        m_pool->alloc(sizeof(Header) + oldSize);
+    }
+
+    void* result = tryAllocate(newSize);
+    if (!result)
+        return nullptr;
+    memcpy(result, pointer, std::min(oldSize, newSize));
+    return result;
+}
+
+void BumpArena::deallocate(void* pointer)
+{
+    ASSERT(contains(pointer));
+    Header* header = headerFor(pointer);
+    if (header != m_lastAllocation)
+        return;
+    m_pool = m_pool->dealloc(header);
+    m_lastAllocation = nullptr;
+}
+
+void BumpArena::shrink()
+{
+    RELEASE_ASSERT(!m_scopeDepth);
+    m_allocator.stopAllocator();
+    m_pool = nullptr;
+    m_lastAllocation = nullptr;
+}
+
+BumpArena* BumpArenaMalloc::arenaContaining(void* pointer)
+{
+    for (BumpArena::Scope* scope = currentScope; scope; scope = scope->m_previous) {
+        if (scope->m_arena.contains(pointer))
+            return &scope->m_arena;
+    }
+    return nullptr;
+}
+
+void* BumpArenaMalloc::malloc(size_t size)
+{
+    if (currentScope) {
+        if (void* result = currentScope->m_arena.tryAllocate(size))
+            return result;
+    }
+    return fastMalloc(size);
+}
+
+void* BumpArenaMalloc::tryMalloc(size_t size)
+{
+    if (currentScope) {
+        if (void* result = currentScope->m_arena.tryAllocate(size))
+            return result;
+    }
+    return FastMalloc::tryMalloc(size);
+}
+
+void* BumpArenaMalloc::realloc(void* pointer, size_t size)
+{
+    if (!pointer)
+        return malloc(size);
+
+    BumpArena* arena = arenaContaining(pointer);
+    if (!arena)
+        return fastRealloc(pointer, size);
+
+    if (void* result = arena->tryReallocate(pointer, size))
+        return result;
+    void* result = fastMalloc(size);
+    memcpy(result, pointer, std::min(arena->allocationSize(pointer), size));
+    return result;
+}
+
+void BumpArenaMalloc::free(void* pointer)
+{
+    if (!pointer)
+        return;
+    if (BumpArena* arena = arenaContaining(pointer)) {
+        arena->deallocate(pointer);
+        return;
+    }
+    fastFree(pointer);
+}
+
+} // namespace WTF
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_END
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <wtf/BumpPointerAllocator.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/ForbidHeapAllocation.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/StdLibExtras.h>
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_BEGIN
+
+namespace WTF {
+
+// A BumpArena hands out memory for short-lived scratch data, such as the rules matched for the element
+// being styled. Allocating bumps a pointer and freeing does nothing, except for the most recent allocation,
+// which can also grow in place. Everything allocated while a Scope is active is reclaimed when it ends.
+//
+// Containers opt in by using BumpArenaMalloc as their Malloc policy, for example
+// Vector<T, 0, CrashOnOverflow, 16, BumpArenaMalloc>. BumpArenaMalloc allocates from the arena of the
+// innermost Scope of the current thread. It falls back to fastMalloc when there is no Scope or the arena is
+// full, so these containers can be used anywhere. The one rule is that a container which allocated while a
+// Scope was active must be destroyed before the outermost Scope on that arena ends.
+//
+// Scopes nest, but only the outermost Scope on an arena reclaims memory. A nested Scope cannot tell which
+// containers outlive it, so rewinding there could free a buffer that an outer container still uses.
+//
+// The arena keeps the pages it grew to until it is destroyed or shrink() is called.
+class BumpArena {
+    WTF_MAKE_NONCOPYABLE(BumpArena);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr size_t defaultMaxCapacity = 16 * MB;
+
+    explicit BumpArena(size_t maxCapacity = defaultMaxCapacity)
+        : m_maxCapacity(maxCapacity)
+    {
+    }
+
+    ~BumpArena()
+    {
+        ASSERT(!m_scopeDepth);
+    }
+
+    class Scope {
+        WTF_MAKE_NONCOPYABLE(Scope);
+        WTF_FORBID_HEAP_ALLOCATION;
+    public:
+        WTF_EXPORT_PRIVATE explicit Scope(BumpArena&);
+        WTF_EXPORT_PRIVATE ~Scope();
+
+    private:
+        friend struct BumpArenaMalloc;
+
+        BumpArena& m_arena;
+        Scope* m_previous;
+        // Only set for the outermost Scope on the arena.
+        void* m_position { nullptr };
+    };
+
+    // These return null when the arena has reached its maximum capacity.
+    WTF_EXPORT_PRIVATE void* tryAllocate(size_t);
+    WTF_EXPORT_PRIVATE void* tryReallocate(void*, size_t);
+
+    WTF_EXPORT_PRIVATE void deallocate(void*);
+
+    bool contains(const void* pointer) const { return m_pool && m_pool->contains(pointer); }
+    size_t allocationSize(const void* pointer) const { return headerFor(pointer)->size; }
+
+    // Releases all the pages but the first. Must not be called while a Scope is active.
+    WTF_EXPORT_PRIVATE void shrink();
+
+private:
+    static constexpr size_t alignment = 16;
+
+    struct alignas(alignment) Header {
+        size_t size;
+    };
+
+    static Header* headerFor(void* pointer) { return static_cast<Header*>(pointer) - 1; }
+    static const Header* headerFor(const void* pointer) { return static_cast<const Header*>(pointer) - 1; }
+
+    BumpPointerAllocator m_allocator;
+    BumpPointerPool* m_pool { nullptr };
+    // The header of the most recent allocation if it has not been freed yet.
+    Header* m_lastAllocation { nullptr };
+    size_t m_maxCapacity;
+    unsigned m_scopeDepth { 0 };
+};
+
+struct BumpArenaMalloc {
+    WTF_EXPORT_PRIVATE static void* malloc(size_t);
+    WTF_EXPORT_PRIVATE static void* tryMalloc(size_t);
+    WTF_EXPORT_PRIVATE static void* realloc(void*, size_t);
+    WTF_EXPORT_PRIVATE static void free(void*);
+
+    static constexpr ALWAYS_INLINE size_t nextCapacity(size_t capacity)
+    {
+        return FastMalloc::nextCapacity(capacity);
+    }
+
+private:
+    static BumpArena* arenaContaining(void*);
+};
+
+} // namespace WTF
+
+using WTF::BumpArena;
+using WTF::BumpArenaMalloc;
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_END
@@ -90,6 +90,21 @@ public:
         return deallocCrossPool(this, position);
     }
 
+    // The position the next allocation will start at. Passing it to dealloc
+    // releases everything allocated after this call.
+    void* position() const { return m_current; }
+
+    // Returns true if position is within this pool or any pool before it in
+    // the chain, which is where all live allocations are.
+    bool contains(const void* position) const
+    {
+        for (const BumpPointerPool* pool = this; pool; pool = pool->m_previous) {
+            if ((position >= pool->m_start) && (position < static_cast<const void*>(pool)))
+                return true;
+        }
+        return false;
+    }
+
 private:
     // Placement operator new, returns the last 'size' bytes of allocation for use as this.
     void* operator new(size_t size, const PageAllocation& allocation)
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include <wtf/CoroutineUtilities.h>
+
+#include <array>
+#include <wtf/FastMalloc.h>
+
+namespace WTF {
+
+// Frames are pooled in 64 byte size classes up to 1KB. Bigger frames are rare and go straight to fastMalloc.
+static constexpr size_t frameSizeClassStep = 64;
+static constexpr size_t maxPooledFrameSize = 1024;
+static constexpr size_t numberOfFrameSizeClasses = maxPooledFrameSize / frameSizeClassStep;
+static constexpr unsigned maxPooledFramesPerSizeClass = 16;
+
+static size_t frameSizeClass(size_t size)
+{
+    ASSERT(size);
+    return (size - 1) / frameSizeClassStep;
+}
+
+class CoroutineFramePool {
+public:
+    ~CoroutineFramePool();
+
+    void* take(size_t sizeClass);
+    bool give(void*, size_t sizeClass);
+
+private:
+    struct FreeFrame {
+        FreeFrame* next;
+    };
+
+    std::array<FreeFrame*, numberOfFrameSizeClasses> m_freeFrames { };
+    std::array<unsigned, numberOfFrameSizeClasses> m_numberOfFreeFrames { };
+};
+
+static thread_local CoroutineFramePool framePool;
+// Frames can be freed while the thread is exiting, after framePool has been destroyed.
+static thread_local bool framePoolIsDestroyed;
+
+CoroutineFramePool::~CoroutineFramePool()
+{
+    for (auto* frame : m_freeFrames) {
+        while (frame)
+            fastFree(std::exchange(frame, frame->next));
+    }
+    framePoolIsDestroyed = true;
+}
+
+void* CoroutineFramePool::take(size_t sizeClass)
+{
+    auto*& head = m_freeFrames[sizeClass];
+    if (!head)
+        return nullptr;
+    --m_numberOfFreeFrames[sizeClass];
+    return std::exchange(head, head->next);
+}
+
+bool CoroutineFramePool::give(void* pointer, size_t sizeClass)
+{
+    if (m_numberOfFreeFrames[sizeClass] == maxPooledFramesPerSizeClass)
+        return false;
+    ++m_numberOfFreeFrames[sizeClass];
+    m_freeFrames[sizeClass] = new (NotNull, pointer) FreeFrame { m_freeFrames[sizeClass] };
+    return true;
+}
+
+void* CoroutineFrameAllocator::allocate(size_t size)
+{
+    if (size > maxPooledFrameSize || framePoolIsDestroyed)
+        return fastMalloc(size);
+    size_t sizeClass = frameSizeClass(size);
+    if (auto* frame = framePool.take(sizeClass))
+        return frame;
+    // Round up so that the frame can be reused for any size in its class.
+    return fastMalloc((sizeClass + 1) * frameSizeClassStep);
+}
+
+void CoroutineFrameAllocator::deallocate(void* pointer, size_t size)
+{
+    // Frames are usually freed on a different thread than the one they were allocated on, since coroutines
+    // hop between queues. That's fine: the pools only hold frames that are free.
+    if (size > maxPooledFrameSize || framePoolIsDestroyed || !framePool.give(pointer, frameSizeClass(size)))
+        fastFree(pointer);
+}
+
+} // namespace WTF
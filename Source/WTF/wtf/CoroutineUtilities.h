@@ -26,10 +26,28 @@
 #pragma once
 
 #include <coroutine>
+#include <optional>
 #include <wtf/CompletionHandler.h>
+#include <wtf/Ref.h>
 
 namespace WTF {
 
+// A coroutine frame holds what would otherwise be captured by the lambdas passed from one queue to the
+// next, so frames are allocated and freed about as often as those lambdas. CoroutineFrameAllocator keeps
+// a few freed frames of each size around on every thread, so that steady state coroutines don't hit malloc.
+class CoroutineFrameAllocator {
+public:
+    WTF_EXPORT_PRIVATE static void* allocate(size_t);
+    WTF_EXPORT_PRIVATE static void deallocate(void*, size_t);
+};
+
+#define WTF_MAKE_COROUTINE_FRAME_ALLOCATED \
+public: \
+    static void* operator new(size_t size) { return WTF::CoroutineFrameAllocator::allocate(size); } \
+    static void operator delete(void* pointer, size_t size) { WTF::CoroutineFrameAllocator::deallocate(pointer, size); } \
+private: \
+using __thisIsHereToForceASemicolonAfterThisMacro UNUSED_TYPE_ALIAS = int
+
 template<typename PromiseType>
 class CoroutineHandle {
 public:
@@ -61,7 +79,7 @@ class [[nodiscard]] Awaitable {
     WTF_FORBID_HEAP_ALLOCATION;
 public:
     class PromiseBase {
-        WTF_MAKE_FAST_ALLOCATED;
+        WTF_MAKE_COROUTINE_FRAME_ALLOCATED;
     public:
         struct final_awaitable {
             WTF_FORBID_HEAP_ALLOCATION;
@@ -124,7 +142,8 @@ struct Task {
     WTF_FORBID_HEAP_ALLOCATION;
 public:
     struct promise_type {
-        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+        WTF_MAKE_COROUTINE_FRAME_ALLOCATED;
+    public:
         Task get_return_object() { return { }; }
         std::suspend_never initial_suspend() { return { }; }
         std::suspend_never final_suspend() noexcept { return { }; }
@@ -170,9 +189,37 @@ private:
     Callback m_callback;
 };
 
+// co_await resumeOn(queue) suspends the coroutine and resumes it on queue, which can be a WorkQueue,
+// a ConcurrentWorkQueue or a RunLoop.
+template<typename Dispatcher> class [[nodiscard]] ResumeOn {
+    WTF_FORBID_HEAP_ALLOCATION;
+public:
+    explicit ResumeOn(Dispatcher& dispatcher)
+        : m_dispatcher(dispatcher) { }
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // The coroutine may resume, and destroy this awaiter, before dispatch() returns.
+        Ref dispatcher = m_dispatcher;
+        dispatcher->dispatch([handle] mutable {
+            handle();
+        });
+    }
+    void await_resume() { }
+private:
+    Ref<Dispatcher> m_dispatcher;
+};
+
+template<typename Dispatcher> ResumeOn<Dispatcher> resumeOn(Dispatcher& dispatcher)
+{
+    return ResumeOn<Dispatcher> { dispatcher };
+}
+
 }
 
 using WTF::Awaitable;
 using WTF::AwaitableFromCompletionHandler;
+using WTF::CoroutineFrameAllocator;
 using WTF::CoroutineHandle;
 using WTF::Task;
+using WTF::resumeOn;
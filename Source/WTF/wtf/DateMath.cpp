@@ -609,6 +609,35 @@ static bool parseES5TimePortion(std::span<const LChar>& currentPosition, long& h
     return true;
 }
 
+// Validates the fields parsed from a date-time string format and combines them into a time value.
+static double es5DateToMilliseconds(int year, long month, long day, long hours, long minutes, long seconds, double milliseconds, long timeZoneSeconds)
+{
+    static constexpr std::array<long, 12> daysPerMonth { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+    // A few of these checks could be done inline by the parsers, but since many of them are interrelated
+    // we would be sacrificing readability to "optimize" the (presumably less common) failure path.
+    if (month < 1 || month > 12)
+        return std::numeric_limits<double>::quiet_NaN();
+    if (day < 1 || day > daysPerMonth[month - 1])
+        return std::numeric_limits<double>::quiet_NaN();
+    if (month == 2 && day > 28 && !isLeapYear(year))
+        return std::numeric_limits<double>::quiet_NaN();
+    if (hours < 0 || hours > 24)
+        return std::numeric_limits<double>::quiet_NaN();
+    if (hours == 24 && (minutes || seconds))
+        return std::numeric_limits<double>::quiet_NaN();
+    if (minutes < 0 || minutes > 59)
+        return std::numeric_limits<double>::quiet_NaN();
+    if (seconds < 0 || seconds >= 61)
+        return std::numeric_limits<double>::quiet_NaN();
+    if (seconds == 60) {
+        // Discard leap seconds by clamping to the end of a minute.
+        milliseconds = 0;
+    }
+
+    return ymdhmsToMilliseconds(year, month, day, hours, minutes, seconds, milliseconds) - (timeZoneSeconds * msPerSecond);
+}
+
 double parseES5Date(std::span<const LChar> dateString, bool& isLocalTime)
 {
     isLocalTime = false;
@@ -616,9 +645,7 @@ double parseES5Date(std::span<const LChar> dateString, bool& isLocalTime)
     // This parses a date of the form defined in ecma262/#sec-date-time-string-format
     // (similar to RFC 3339 / ISO 8601: YYYY-MM-DDTHH:mm:ss[.sss]Z).
     // In most cases it is intentionally strict (e.g. correct field widths, no stray whitespace).
-    
-    static constexpr std::array<long, 12> daysPerMonth { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
-    
+
     // The year must be present, but the other fields may be omitted - see ES5.1 15.9.1.15.
     int year = 0;
     long month = 1;
@@ -644,28 +671,157 @@ double parseES5Date(std::span<const LChar> dateString, bool& isLocalTime)
     if (!dateString.empty())
         return std::numeric_limits<double>::quiet_NaN();
 
-    // A few of these checks could be done inline above, but since many of them are interrelated
-    // we would be sacrificing readability to "optimize" the (presumably less common) failure path.
-    if (month < 1 || month > 12)
-        return std::numeric_limits<double>::quiet_NaN();
-    if (day < 1 || day > daysPerMonth[month - 1])
-        return std::numeric_limits<double>::quiet_NaN();
-    if (month == 2 && day > 28 && !isLeapYear(year))
-        return std::numeric_limits<double>::quiet_NaN();
-    if (hours < 0 || hours > 24)
-        return std::numeric_limits<double>::quiet_NaN();
-    if (hours == 24 && (minutes || seconds))
-        return std::numeric_limits<double>::quiet_NaN();
-    if (minutes < 0 || minutes > 59)
-        return std::numeric_limits<double>::quiet_NaN();
-    if (seconds < 0 || seconds >= 61)
-        return std::numeric_limits<double>::quiet_NaN();
-    if (seconds == 60) {
-        // Discard leap seconds by clamping to the end of a minute.
-        milliseconds = 0;
+    return es5DateToMilliseconds(year, month, day, hours, minutes, seconds, milliseconds, timeZoneSeconds);
+}
+
+// Reads exactly digitCount ASCII digits. Unlike parseLong, this never looks past the end of the span,
+// so it works on characters that are not null-terminated.
+static bool parseFixedWidthDigits(std::span<const LChar>& string, size_t digitCount, long& result)
+{
+    if (string.size() < digitCount)
+        return false;
+    long value = 0;
+    for (auto character : string.first(digitCount)) {
+        if (!isASCIIDigit(character))
+            return false;
+        value = value * 10 + (character - '0');
     }
-        
-    return ymdhmsToMilliseconds(year, month, day, hours, minutes, seconds, milliseconds) - (timeZoneSeconds * msPerSecond);
+    skip(string, digitCount);
+    result = value;
+    return true;
+}
+
+// Parses YYYY-MM-DD[(T|t| )HH:mm[:ss[.s+]][Z|(+|-)(00:00|0000|00)]] with a four digit year, the shape of
+// Date.prototype.toISOString and of nearly every machine generated timestamp. parseES5Date is more lenient,
+// so this returns std::nullopt rather than NaN whenever the input does not match exactly, and the caller
+// falls back to the general parsers.
+static std::optional<double> parseISODateFast(std::span<const LChar> dateString, bool& isLocalTime)
+{
+    isLocalTime = false;
+
+    long year = 0;
+    long month = 0;
+    long day = 0;
+    long hours = 0;
+    long minutes = 0;
+    long seconds = 0;
+    double milliseconds = 0;
+    long timeZoneSeconds = 0;
+
+    if (!parseFixedWidthDigits(dateString, 4, year) || !skipExactly(dateString, '-'))
+        return std::nullopt;
+    if (!parseFixedWidthDigits(dateString, 2, month) || !skipExactly(dateString, '-'))
+        return std::nullopt;
+    if (!parseFixedWidthDigits(dateString, 2, day))
+        return std::nullopt;
+
+    if (skipExactly(dateString, 'T') || skipExactly(dateString, 't') || skipExactly(dateString, ' ')) {
+        if (!parseFixedWidthDigits(dateString, 2, hours) || !skipExactly(dateString, ':'))
+            return std::nullopt;
+        if (!parseFixedWidthDigits(dateString, 2, minutes))
+            return std::nullopt;
+        if (skipExactly(dateString, ':')) {
+            if (!parseFixedWidthDigits(dateString, 2, seconds))
+                return std::nullopt;
+            if (skipExactly(dateString, '.')) {
+                // Like parseES5Date, accept any number of fraction digits, up to what fits without rounding.
+                size_t numFracDigits = 0;
+                while (numFracDigits < dateString.size() && isASCIIDigit(dateString[numFracDigits]))
+                    ++numFracDigits;
+                long fracSeconds;
+                if (!numFracDigits || numFracDigits > 9 || !parseFixedWidthDigits(dateString, numFracDigits, fracSeconds))
+                    return std::nullopt;
+                milliseconds = fracSeconds * pow(10.0, static_cast<double>(-static_cast<long>(numFracDigits) + 3));
+            }
+        }
+
+        if (!skipExactly(dateString, 'Z')) {
+            bool tzNegative;
+            if (skipExactly(dateString, '-'))
+                tzNegative = true;
+            else if (skipExactly(dateString, '+'))
+                tzNegative = false;
+            else {
+                if (!dateString.empty())
+                    return std::nullopt;
+                isLocalTime = true;
+                return es5DateToMilliseconds(year, month, day, hours, minutes, seconds, milliseconds, timeZoneSeconds);
+            }
+
+            long tzHours = 0;
+            long tzMinutes = 0;
+            if (!parseFixedWidthDigits(dateString, 2, tzHours))
+                return std::nullopt;
+            if (skipExactly(dateString, ':')) {
+                if (!parseFixedWidthDigits(dateString, 2, tzMinutes))
+                    return std::nullopt;
+            } else if (!dateString.empty() && !parseFixedWidthDigits(dateString, 2, tzMinutes))
+                return std::nullopt;
+
+            if (tzHours > 24 || tzMinutes > 59)
+                return std::nullopt;
+            timeZoneSeconds = 60 * (tzMinutes + (60 * tzHours));
+            if (tzNegative)
+                timeZoneSeconds = -timeZoneSeconds;
+        }
+    }
+
+    if (!dateString.empty())
+        return std::nullopt;
+
+    return es5DateToMilliseconds(year, month, day, hours, minutes, seconds, milliseconds, timeZoneSeconds);
+}
+
+// Parses "Www, DD Mon YYYY HH:mm:ss GMT", the RFC 2822 shape of Date.prototype.toUTCString and of HTTP dates.
+// Like parseISODateFast, this returns std::nullopt for anything parseDate might read differently.
+static std::optional<double> parseRFC2822DateFast(std::span<const LChar> dateString, bool& isLocalTime)
+{
+    isLocalTime = false;
+
+    auto skipName = [&](std::span<const ASCIILiteral> names) -> std::optional<size_t> {
+        for (size_t index = 0; index < names.size(); ++index) {
+            if (skipCharactersExactly(dateString, names[index].span8()))
+                return index;
+        }
+        return std::nullopt;
+    };
+
+    long day = 0;
+    long year = 0;
+    long hours = 0;
+    long minutes = 0;
+    long seconds = 0;
+
+    if (!skipName(weekdayName) || !skipExactly(dateString, ',') || !skipExactly(dateString, ' '))
+        return std::nullopt;
+    if (!parseFixedWidthDigits(dateString, 2, day) || !skipExactly(dateString, ' '))
+        return std::nullopt;
+    auto month = skipName(monthName);
+    if (!month || !skipExactly(dateString, ' '))
+        return std::nullopt;
+    if (!parseFixedWidthDigits(dateString, 4, year) || !skipExactly(dateString, ' '))
+        return std::nullopt;
+    if (!parseFixedWidthDigits(dateString, 2, hours) || !skipExactly(dateString, ':'))
+        return std::nullopt;
+    if (!parseFixedWidthDigits(dateString, 2, minutes) || !skipExactly(dateString, ':'))
+        return std::nullopt;
+    if (!parseFixedWidthDigits(dateString, 2, seconds) || !skipCharactersExactly(dateString, " GMT"_span8))
+        return std::nullopt;
+    if (!dateString.empty())
+        return std::nullopt;
+
+    // parseDate maps two digit years into 1950-2049 and reads days past 31 as the start of YYYY/MM/DD.
+    if (year < 100 || day > 31 || hours > 23 || minutes > 59 || seconds > 59)
+        return std::nullopt;
+
+    return ymdhmsToMilliseconds(year, *month + 1, day, hours, minutes, seconds, 0);
+}
+
+std::optional<double> parseDateFast(std::span<const LChar> dateString, bool& isLocalTime)
+{
+    if (auto value = parseISODateFast(dateString, isLocalTime))
+        return value;
+    return parseRFC2822DateFast(dateString, isLocalTime);
 }
 
 // Odd case where 'exec' is allowed to be 0, to accomodate a caller in WebCore.
@@ -44,6 +44,7 @@
 #pragma once
 
 #include <math.h>
+#include <optional>
 #include <stdint.h>
 #include <string.h>
 #include <time.h>
@@ -78,6 +79,9 @@ int equivalentYearForDST(int year);
 
 // Not really math related, but this is currently the only shared place to put these.
 WTF_EXPORT_PRIVATE double parseES5Date(std::span<const LChar> dateString, bool& isLocalTime);
+// Handles the ISO 8601 and RFC 2822 shapes that toISOString and toUTCString produce without needing a
+// null-terminated string. Returns std::nullopt for anything else; use parseES5Date and parseDate for those.
+WTF_EXPORT_PRIVATE std::optional<double> parseDateFast(std::span<const LChar> dateString, bool& isLocalTime);
 WTF_EXPORT_PRIVATE double parseDate(std::span<const LChar> dateString);
 WTF_EXPORT_PRIVATE double parseDate(std::span<const LChar> dateString, bool& isLocalTime);
 // dayOfWeek: [0, 6] 0 being Monday, day: [1, 31], month: [0, 11], year: ex: 2011, hours: [0, 23], minutes: [0, 59], seconds: [0, 59], utcOffset: [-720,720]. 
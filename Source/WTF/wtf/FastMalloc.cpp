@@ -28,6 +28,7 @@
 
 #include <string.h>
 #include <wtf/CheckedArithmetic.h>
+#include <wtf/MemoryFootprint.h>
 
 #if OS(DARWIN)
 #include <malloc/malloc.h>
@@ -279,6 +280,7 @@ TryMallocReturnValue tryFastRealloc(void* p, size_t n)
 
 void releaseFastMallocFreeMemory() { }
 void releaseFastMallocFreeMemoryForThisThread() { }
+void donateFastMallocThreadCache() { }
 
 FastMallocStatistics fastMallocStatistics()
 {
@@ -286,6 +288,13 @@ FastMallocStatistics fastMallocStatistics()
     return statistics;
 }
 
+std::optional<MallocTelemetry> mallocTelemetry()
+{
+    return std::nullopt;
+}
+
+void dumpMallocTelemetry() { }
+
 size_t fastMallocSize(const void* p)
 {
 #if OS(DARWIN)
@@ -310,6 +319,8 @@ void fastDecommitAlignedMemory(void* ptr, size_t size)
 
 void fastEnableMiniMode(bool) { }
 
+bool fastEnableTransparentHugePages() { return false; }
+
 void fastDisableScavenger() { }
 
 void fastMallocDumpMallocStats() { }
@@ -331,6 +342,11 @@ void* tryFastCompactAlignedMalloc(size_t alignment, size_t size) { return tryFas
 
 #include <bmalloc/bmalloc.h>
 
+#if BUSE(LIBPAS)
+#include <bmalloc/pas_fd_stream.h>
+#include <bmalloc/pas_telemetry.h>
+#endif
+
 namespace WTF {
 
 #define TRACK_MALLOC_CALLSTACK 0
@@ -797,6 +813,11 @@ void releaseFastMallocFreeMemoryForThisThread()
     bmalloc::api::scavengeThisThread();
 }
 
+void donateFastMallocThreadCache()
+{
+    bmalloc::api::donateThisThreadCache();
+}
+
 void releaseFastMallocFreeMemory()
 {
     bmalloc::api::scavenge();
@@ -828,6 +849,34 @@ FastMallocStatistics fastMallocStatistics()
     return statistics;
 }
 
+std::optional<MallocTelemetry> mallocTelemetry()
+{
+#if BUSE(LIBPAS)
+    pas_telemetry_counters counters;
+    pas_telemetry_get_counters(&counters);
+
+    MallocTelemetry telemetry;
+    telemetry.committedBytes = counters.committed_bytes;
+    telemetry.decommittedBytes = counters.decommitted_bytes;
+    telemetry.scavengerDecommittedBytes = counters.scavenger_decommitted_bytes;
+    telemetry.scavengerTicks = counters.num_scavenger_ticks;
+    if (counters.inline_allocations_are_counted)
+        telemetry.threadLocalCacheHits = counters.num_inline_allocations;
+    telemetry.threadLocalCacheMisses = counters.num_allocator_refills;
+    telemetry.deallocationLogFlushes = counters.num_deallocation_log_flushes;
+    return telemetry;
+#else
+    return std::nullopt;
+#endif
+}
+
+void dumpMallocTelemetry()
+{
+#if BUSE(LIBPAS)
+    pas_telemetry_dump(&pas_log_stream.base);
+#endif
+}
+
 void fastCommitAlignedMemory(void* ptr, size_t size)
 {
     bmalloc::api::commitAlignedPhysical(ptr, size);
@@ -843,6 +892,11 @@ void fastEnableMiniMode(bool forceMiniMode)
     bmalloc::api::enableMiniMode(forceMiniMode);
 }
 
+bool fastEnableTransparentHugePages()
+{
+    return bmalloc::api::enableTransparentHugePages();
+}
+
 void fastDisableScavenger()
 {
     bmalloc::api::disableScavenger();
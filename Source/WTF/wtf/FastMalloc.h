@@ -195,11 +195,15 @@ WTF_EXPORT_PRIVATE size_t fastMallocGoodSize(size_t);
 
 WTF_EXPORT_PRIVATE void releaseFastMallocFreeMemory();
 WTF_EXPORT_PRIVATE void releaseFastMallocFreeMemoryForThisThread();
+// For short-lived threads that are about to exit. Unlike releaseFastMallocFreeMemoryForThisThread(), this
+// also lets the next thread reuse this thread's malloc cache rather than build its own.
+WTF_EXPORT_PRIVATE void donateFastMallocThreadCache();
 
 WTF_EXPORT_PRIVATE void fastCommitAlignedMemory(void*, size_t);
 WTF_EXPORT_PRIVATE void fastDecommitAlignedMemory(void*, size_t);
 
 WTF_EXPORT_PRIVATE void fastEnableMiniMode(bool forceMiniMode = false);
+WTF_EXPORT_PRIVATE bool fastEnableTransparentHugePages();
 
 WTF_EXPORT_PRIVATE void fastDisableScavenger();
 
@@ -25,11 +25,43 @@
 
 #pragma once
 
+#include <optional>
+
 namespace WTF {
 
 WTF_EXPORT_PRIVATE size_t memoryFootprint();
 
+// Cheap, cumulative counters from the malloc implementation, meant to be sampled continuously. They are
+// only available when fastMalloc is backed by libpas. Sample twice and subtract to get rates.
+struct MallocTelemetry {
+    uint64_t committedBytes { 0 };
+    uint64_t decommittedBytes { 0 };
+    uint64_t scavengerDecommittedBytes { 0 };
+    uint64_t scavengerTicks { 0 };
+    // Hits are counted on the allocation fast path, so libpas only counts them when built with
+    // PAS_ENABLE_INLINE_ALLOCATION_COUNTING. Misses (refills) are always counted.
+    std::optional<uint64_t> threadLocalCacheHits;
+    uint64_t threadLocalCacheMisses { 0 };
+    uint64_t deallocationLogFlushes { 0 };
+
+    std::optional<double> threadLocalCacheHitRate() const
+    {
+        if (!threadLocalCacheHits)
+            return std::nullopt;
+        uint64_t total = *threadLocalCacheHits + threadLocalCacheMisses;
+        return total ? static_cast<double>(*threadLocalCacheHits) / total : 0;
+    }
+};
+
+WTF_EXPORT_PRIVATE std::optional<MallocTelemetry> mallocTelemetry();
+
+// Dumps the counters along with per-heap and per-size-class stats to the libpas log. This walks the heaps.
+WTF_EXPORT_PRIVATE void dumpMallocTelemetry();
+
 }
 
+using WTF::MallocTelemetry;
+using WTF::dumpMallocTelemetry;
+using WTF::mallocTelemetry;
 using WTF::memoryFootprint;
 
@@ -360,6 +360,17 @@ void MemoryPressureHandler::ReliefLogger::logMemoryUsageChange()
         m_logString,
         m_initialMemory->resident, currentMemory->resident, residentDiff,
         m_initialMemory->physical, currentMemory->physical, physicalDiff);
+
+    auto currentMallocTelemetry = mallocTelemetry();
+    if (!currentMallocTelemetry || !m_initialMallocTelemetry)
+        return;
+
+    MEMORYPRESSURE_LOG("Memory pressure relief: %" PUBLIC_LOG_STRING ": malloc decommitted = %" PRIu64 " (scavenger %" PRIu64 "), committed = %" PRIu64 ", thread local cache refills = %" PRIu64,
+        m_logString,
+        currentMallocTelemetry->decommittedBytes - m_initialMallocTelemetry->decommittedBytes,
+        currentMallocTelemetry->scavengerDecommittedBytes - m_initialMallocTelemetry->scavengerDecommittedBytes,
+        currentMallocTelemetry->committedBytes - m_initialMallocTelemetry->committedBytes,
+        currentMallocTelemetry->threadLocalCacheMisses - m_initialMallocTelemetry->threadLocalCacheMisses);
 }
 
 #if !OS(WINDOWS)
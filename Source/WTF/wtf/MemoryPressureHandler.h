@@ -31,6 +31,7 @@
 #include <wtf/FastMalloc.h>
 #include <wtf/Forward.h>
 #include <wtf/Function.h>
+#include <wtf/MemoryFootprint.h>
 #include <wtf/RunLoop.h>
 
 #if OS(WINDOWS)
@@ -150,6 +151,7 @@ public:
         explicit ReliefLogger(const char *log)
             : m_logString(log)
             , m_initialMemory(loggingEnabled() ? platformMemoryUsage() : MemoryUsage { })
+            , m_initialMallocTelemetry(loggingEnabled() ? mallocTelemetry() : std::nullopt)
         {
         }
 
@@ -188,6 +190,7 @@ public:
 
         const char* m_logString;
         std::optional<MemoryUsage> m_initialMemory;
+        std::optional<MallocTelemetry> m_initialMallocTelemetry;
 
         WTF_EXPORT_PRIVATE static bool s_loggingEnabled;
     };
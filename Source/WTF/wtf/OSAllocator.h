@@ -82,6 +82,15 @@ public:
 
     WTF_EXPORT_PRIVATE static void protect(void*, size_t, bool readable, bool writable);
     WTF_EXPORT_PRIVATE static bool tryProtect(void*, size_t, bool readable, bool writable);
+
+    // Opts uncommitted reservations of at least one huge page into transparent huge pages, and aligns
+    // them to the huge page size so that the kernel can back them with huge pages from the start.
+    // This is meant to be called once, before any reservation. Returns false if the OS does not
+    // support transparent huge pages, in which case nothing changes.
+    WTF_EXPORT_PRIVATE static bool enableTransparentHugePages();
+
+    // Zero unless enableTransparentHugePages() succeeded.
+    WTF_EXPORT_PRIVATE static size_t transparentHugePageSize();
 };
 
 inline void* OSAllocator::reserveAndCommit(size_t reserveSize, size_t commitSize, Usage usage, bool writable, bool executable, bool jitCageEnabled)
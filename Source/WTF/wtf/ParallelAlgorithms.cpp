@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include <wtf/ParallelAlgorithms.h>
+
+#include <mutex>
+#include <wtf/NumberOfCores.h>
+#include <wtf/ParallelHelperPool.h>
+#include <wtf/SetForScope.h>
+
+namespace WTF {
+
+static thread_local bool isInParallelAlgorithm;
+
+ParallelHelperPool& parallelAlgorithmsPool()
+{
+    static std::once_flag onceFlag;
+    static ParallelHelperPool* pool;
+    std::call_once(onceFlag, [] {
+#if OS(LINUX)
+        constexpr auto threadName = "ParallelHelper"_s;
+#else
+        constexpr auto threadName = "WTF Parallel Helper Thread"_s;
+#endif
+        pool = new ParallelHelperPool(threadName);
+        pool->ensureThreads(std::max(numberOfProcessorCores(), 1) - 1);
+    });
+    return *pool;
+}
+
+size_t parallelGrainSize(size_t count, size_t grainSize)
+{
+    if (grainSize)
+        return grainSize;
+    // A few chunks per participant leave room to even out chunks that take longer than others.
+    static constexpr size_t chunksPerParticipant = 4;
+    size_t numberOfParticipants = parallelAlgorithmsPool().numberOfThreads() + 1;
+    return std::max<size_t>(count / (numberOfParticipants * chunksPerParticipant), 1);
+}
+
+namespace {
+
+// A participant's share of the chunks. Whoever claims a chunk, its owner or another participant, does so
+// by bumping next.
+struct ChunkShare {
+    std::atomic<size_t> next { 0 };
+    size_t end { 0 };
+};
+
+} // anonymous namespace
+
+IterationStatus parallelForChunks(size_t begin, size_t end, size_t grainSize, const ScopedLambda<IterationStatus(size_t, size_t)>& chunkFunction)
+{
+    if (begin >= end)
+        return IterationStatus::Continue;
+
+    size_t count = end - begin;
+    grainSize = parallelGrainSize(count, grainSize);
+    size_t numberOfChunks = count / grainSize + !!(count % grainSize);
+    auto runChunk = [&](size_t chunk) {
+        size_t chunkBegin = begin + chunk * grainSize;
+        return chunkFunction(chunkBegin, chunkBegin + std::min(grainSize, end - chunkBegin));
+    };
+
+    auto& pool = parallelAlgorithmsPool();
+    if (numberOfChunks == 1 || !pool.numberOfThreads() || isInParallelAlgorithm) {
+        for (size_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+            if (runChunk(chunk) == IterationStatus::Done)
+                return IterationStatus::Done;
+        }
+        return IterationStatus::Continue;
+    }
+
+    size_t numberOfShares = std::min<size_t>(pool.numberOfThreads() + 1, numberOfChunks);
+    Vector<ChunkShare, 16> shares(numberOfShares);
+    for (size_t i = 0; i < numberOfShares; ++i) {
+        shares[i].next.store(numberOfChunks * i / numberOfShares, std::memory_order_relaxed);
+        shares[i].end = numberOfChunks * (i + 1) / numberOfShares;
+    }
+
+    std::atomic<size_t> nextShare { 0 };
+    std::atomic<bool> isCancelled { false };
+
+    ParallelHelperClient client(&pool);
+    client.runFunctionInParallel([&] {
+        SetForScope inParallelAlgorithm(isInParallelAlgorithm, true);
+        size_t firstShare = nextShare.fetch_add(1, std::memory_order_relaxed) % numberOfShares;
+        for (size_t i = 0; i < numberOfShares; ++i) {
+            auto& share = shares[(firstShare + i) % numberOfShares];
+            while (!isCancelled.load(std::memory_order_relaxed)) {
+                size_t chunk = share.next.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= share.end)
+                    break;
+                if (runChunk(chunk) == IterationStatus::Done)
+                    isCancelled.store(true, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    return isCancelled.load(std::memory_order_relaxed) ? IterationStatus::Done : IterationStatus::Continue;
+}
+
+} // namespace WTF
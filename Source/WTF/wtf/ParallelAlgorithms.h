@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <wtf/IterationStatus.h>
+#include <wtf/ScopedLambda.h>
+#include <wtf/Vector.h>
+
+namespace WTF {
+
+class ParallelHelperPool;
+
+// parallelFor(), parallelReduce() and parallelSort() split a range of indices into chunks of grainSize
+// indices, and run the chunks on the calling thread and on the threads of parallelAlgorithmsPool(). Each
+// participant starts on its own share of the chunks. Once that is done, it takes chunks from the shares of
+// the others, so one slow chunk does not leave the other threads idle. A grainSize of 0 picks one that
+// gives every participant a few chunks; pass a bigger one when a chunk has to do enough work to pay for
+// waking up a thread.
+//
+// A range that fits in a single chunk runs serially on the calling thread, and so does a call made from
+// inside another parallel algorithm.
+//
+// parallelFor() functors may return IterationStatus::Done to cancel. Chunks that have not started yet are
+// skipped, and parallelFor() returns Done once the chunks that are already running have finished.
+
+WTF_EXPORT_PRIVATE ParallelHelperPool& parallelAlgorithmsPool();
+
+WTF_EXPORT_PRIVATE size_t parallelGrainSize(size_t count, size_t grainSize);
+
+WTF_EXPORT_PRIVATE IterationStatus parallelForChunks(size_t begin, size_t end, size_t grainSize, const ScopedLambda<IterationStatus(size_t chunkBegin, size_t chunkEnd)>&);
+
+// Calls functor(chunkBegin, chunkEnd) for consecutive chunks covering [begin, end).
+template<typename Functor>
+IterationStatus parallelFor(size_t begin, size_t end, size_t grainSize, const Functor& functor)
+{
+    return parallelForChunks(begin, end, grainSize, scopedLambda<IterationStatus(size_t, size_t)>([&](size_t chunkBegin, size_t chunkEnd) {
+        if constexpr (std::is_same_v<std::invoke_result_t<Functor, size_t, size_t>, IterationStatus>)
+            return functor(chunkBegin, chunkEnd);
+        else {
+            functor(chunkBegin, chunkEnd);
+            return IterationStatus::Continue;
+        }
+    }));
+}
+
+// Computes mapChunk(chunkBegin, chunkEnd) for every chunk in parallel, then folds the results with
+// combine() in order on the calling thread, so combine() only needs to be associative.
+template<typename T, typename MapChunk, typename Combine>
+T parallelReduce(size_t begin, size_t end, size_t grainSize, T identity, const MapChunk& mapChunk, const Combine& combine)
+{
+    if (begin >= end)
+        return identity;
+
+    grainSize = parallelGrainSize(end - begin, grainSize);
+    size_t numberOfChunks = (end - begin) / grainSize + !!((end - begin) % grainSize);
+    Vector<T> partialResults(numberOfChunks, identity);
+    parallelFor(begin, end, grainSize, [&](size_t chunkBegin, size_t chunkEnd) {
+        partialResults[(chunkBegin - begin) / grainSize] = mapChunk(chunkBegin, chunkEnd);
+    });
+
+    T result = WTFMove(identity);
+    for (auto& partialResult : partialResults)
+        result = combine(WTFMove(result), WTFMove(partialResult));
+    return result;
+}
+
+// Sorts chunks in parallel, then merges neighboring runs pairwise, in parallel as long as there are pairs
+// left. Like std::sort(), it is not stable.
+template<typename T, typename Comparator = std::less<>>
+void parallelSort(std::span<T> data, const Comparator& comparator = { }, size_t grainSize = 0)
+{
+    // Below this, sorting a chunk is cheaper than handing it to another thread.
+    static constexpr size_t minimumSortGrainSize = 4096;
+    if (!grainSize)
+        grainSize = std::max(parallelGrainSize(data.size(), 0), minimumSortGrainSize);
+    if (data.size() <= grainSize) {
+        std::sort(data.begin(), data.end(), comparator);
+        return;
+    }
+
+    parallelFor(0, data.size(), grainSize, [&](size_t chunkBegin, size_t chunkEnd) {
+        std::sort(data.begin() + chunkBegin, data.begin() + chunkEnd, comparator);
+    });
+
+    for (size_t runSize = grainSize; runSize < data.size(); runSize *= 2) {
+        size_t numberOfPairs = data.size() / (2 * runSize) + !!(data.size() % (2 * runSize));
+        parallelFor(0, numberOfPairs, 1, [&](size_t pairsBegin, size_t pairsEnd) {
+            for (size_t pair = pairsBegin; pair < pairsEnd; ++pair) {
+                size_t left = pair * 2 * runSize;
+                size_t middle = std::min(left + runSize, data.size());
+                size_t right = std::min(middle + runSize, data.size());
+                if (middle < right)
+                    std::inplace_merge(data.begin() + left, data.begin() + middle, data.begin() + right, comparator);
+            }
+        });
+    }
+}
+
+} // namespace WTF
+
+using WTF::parallelAlgorithmsPool;
+using WTF::parallelFor;
+using WTF::parallelGrainSize;
+using WTF::parallelReduce;
+using WTF::parallelSort;
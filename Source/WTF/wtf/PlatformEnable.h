@@ -593,6 +593,14 @@
 #define ENABLE_MALLOC_HEAP_BREAKDOWN 0
 #endif
 
+/*
+ * Enable this to log, at exit, which call sites grow their Vectors the most and how long they spend moving elements.
+ * See VectorAllocationTracing.h.
+ */
+#if !defined(ENABLE_VECTOR_ALLOCATION_TRACING)
+#define ENABLE_VECTOR_ALLOCATION_TRACING 0
+#endif
+
 // See RefTrackerMixin.h
 #if ASSERT_ENABLED
 #undef ENABLE_REFTRACKER
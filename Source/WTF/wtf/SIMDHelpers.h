@@ -466,6 +466,19 @@ ALWAYS_INLINE std::optional<uint8_t> findFirstNonZeroIndex(simde_uint64x2_t valu
 #endif
 }
 
+// Incoming value is a comparison result, where each vector element is either all 1s or 0s.
+// Returns a mask whose bit N is set if element N is all 1s, so that callers can visit every match.
+ALWAYS_INLINE uint16_t toBitMask(simde_uint8x16_t value)
+{
+#if CPU(X86_64)
+    return simde_mm_movemask_epi8(simde_uint8x16_to_m128i(value));
+#else
+    constexpr simde_uint8x16_t bitMask { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    auto bits = simde_vandq_u8(value, bitMask);
+    return simde_vaddv_u8(simde_vget_low_u8(bits)) | (static_cast<uint16_t>(simde_vaddv_u8(simde_vget_high_u8(bits))) << 8);
+#endif
+}
+
 template<LChar character, LChar... characters>
 ALWAYS_INLINE simde_uint8x16_t equal(simde_uint8x16_t input)
 {
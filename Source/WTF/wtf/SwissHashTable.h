@@ -0,0 +1,828 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1.  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <bit>
+#include <wtf/AlignedStorage.h>
+#include <wtf/HashTable.h>
+#include <wtf/SIMDHelpers.h>
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_BEGIN
+
+namespace WTF {
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+class SwissHashTable;
+
+// 87.5% load factor. Group probing keeps lookups short even when the table is this full.
+struct DefaultSwissHashTableSizePolicy {
+    static constexpr unsigned maxLoadNumerator = 7;
+    static constexpr unsigned maxLoadDenominator = 8;
+    static constexpr unsigned minLoad = 6;
+};
+
+// SwissHashTable is an open-addressing table in the style of Abseil's "Swiss table" [1].
+//
+// Alongside the buckets, the table keeps one control byte per bucket. A control byte is either
+// emptyControl, deletedControl, or the low 7 bits of the hash of the key stored in the bucket.
+// Buckets are probed in groups of 16: we load the 16 control bytes of a group into a vector register
+// and compare them against the 7-bit hash of the key at once. Only buckets whose control byte matches
+// are compared against the key, so lookups rarely touch more than one bucket, and a miss is usually
+// answered without looking at any bucket at all. Groups are visited with triangular probing, which
+// visits every group once since the group count is a power of two.
+//
+// Unlike RobinHoodHashTable, this does not need to recompute hashes of existing entries on lookup, so the
+// Key does not have to cache its hash. Removal leaves a tombstone only if the group has no empty bucket.
+// Removed buckets are reset to the empty value so that HashTableIterator can skip them without looking
+// at control bytes.
+//
+// Only use this for tables that are expected to hold more than a few thousand entries, or that see many
+// misses or removals. For small tables that stay in cache, plain HashTable inserts and hits faster,
+// since it needs neither the control-byte match nor the second array.
+//
+// [1]: https://abseil.io/about/design/swisstables
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+class SwissHashTable {
+public:
+    using HashTableType = SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>;
+    using iterator = HashTableIterator<HashTableType, Key, Value, Extractor, HashFunctions, Traits, KeyTraits>;
+    using const_iterator = HashTableConstIterator<HashTableType, Key, Value, Extractor, HashFunctions, Traits, KeyTraits>;
+    using ValueTraits = Traits;
+    using KeyType = Key;
+    using ValueType = Value;
+    using IdentityTranslatorType = IdentityHashTranslator<ValueTraits, HashFunctions>;
+    using AddResult = HashTableAddResult<iterator>;
+
+    static constexpr unsigned groupSize = 16;
+    static constexpr unsigned minimumTableSize = std::max<unsigned>(groupSize, KeyTraits::minimumTableSize);
+
+    static_assert(!KeyTraits::hasIsReleasedWeakValueFunction);
+    static_assert(alignof(ValueType) <= groupSize);
+
+    SwissHashTable() = default;
+
+    ~SwissHashTable()
+    {
+        invalidateIterators(this);
+        if (m_table)
+            deallocateTable(m_table, tableSize());
+    }
+
+    SwissHashTable(const SwissHashTable&);
+    void swap(SwissHashTable&);
+    SwissHashTable& operator=(const SwissHashTable&);
+
+    SwissHashTable(SwissHashTable&&);
+    SwissHashTable& operator=(SwissHashTable&&);
+
+    // When the hash table is empty, just return the same iterator for end as for begin.
+    // This is more efficient because we don't have to skip all the empty and deleted
+    // buckets, and iterating an empty table is a common case that's worth optimizing.
+    iterator begin() LIFETIME_BOUND { return isEmpty() ? end() : makeIterator(m_table); }
+    iterator end() LIFETIME_BOUND { return makeKnownGoodIterator(m_table + tableSize()); }
+    const_iterator begin() const LIFETIME_BOUND { return isEmpty() ? end() : makeConstIterator(m_table); }
+    const_iterator end() const LIFETIME_BOUND { return makeKnownGoodConstIterator(m_table + tableSize()); }
+
+    iterator random() LIFETIME_BOUND
+    {
+        if (isEmpty())
+            return end();
+
+        while (true) {
+            auto& bucket = m_table[weakRandomNumber<uint32_t>() & tableSizeMask()];
+            if (!isEmptyBucket(bucket))
+                return makeKnownGoodIterator(&bucket);
+        }
+    }
+
+    const_iterator random() const LIFETIME_BOUND { return static_cast<const_iterator>(const_cast<SwissHashTable*>(this)->random()); }
+
+    unsigned size() const { return keyCount(); }
+    unsigned capacity() const { return tableSize(); }
+    bool isEmpty() const { return !keyCount(); }
+    size_t byteSize() const { return tableSize() * (sizeof(uint8_t) + sizeof(ValueType)); }
+    ALWAYS_INLINE bool isNullStorage() const { return !m_table; }
+
+    void reserveInitialCapacity(unsigned keyCount)
+    {
+        ASSERT(!m_table);
+        ASSERT(!tableSize());
+
+        unsigned newTableSize = computeBestTableSize(keyCount);
+
+        m_table = allocateTable(newTableSize);
+        m_tableSize = newTableSize;
+        m_keyCount = 0;
+        m_deletedCount = 0;
+        internalCheckTableConsistency();
+    }
+
+    template<ShouldValidateKey shouldValidateKey> AddResult add(const ValueType& value) { return add<IdentityTranslatorType, shouldValidateKey>(Extractor::extract(value), [&]() ALWAYS_INLINE_LAMBDA { return value; }); }
+    template<ShouldValidateKey shouldValidateKey> AddResult add(ValueType&& value) { return add<IdentityTranslatorType, shouldValidateKey>(Extractor::extract(value), [&]() ALWAYS_INLINE_LAMBDA { return WTFMove(value); }); }
+
+    // A special version of add() that finds the object by hashing and comparing
+    // with some other type, to avoid the cost of type conversion if the object is already
+    // in the table.
+    template<typename HashTranslator, ShouldValidateKey> AddResult add(auto&& key, NOESCAPE const std::invocable<> auto& functor);
+    template<typename HashTranslator, ShouldValidateKey> AddResult addPassingHashCode(auto&& key, NOESCAPE const std::invocable<> auto& functor);
+
+    template<ShouldValidateKey shouldValidateKey> iterator find(const KeyType& key) { return find<IdentityTranslatorType, shouldValidateKey>(key); }
+    template<ShouldValidateKey shouldValidateKey> const_iterator find(const KeyType& key) const { return find<IdentityTranslatorType, shouldValidateKey>(key); }
+    template<ShouldValidateKey shouldValidateKey> bool contains(const KeyType& key) const { return contains<IdentityTranslatorType, shouldValidateKey>(key); }
+
+    template<typename HashTranslator, ShouldValidateKey, typename T> iterator find(const T&);
+    template<typename HashTranslator, ShouldValidateKey, typename T> const_iterator find(const T&) const;
+    template<typename HashTranslator, ShouldValidateKey, typename T> bool contains(const T&) const;
+
+    void remove(const KeyType&);
+    void remove(iterator);
+    void removeWithoutEntryConsistencyCheck(iterator);
+    void removeWithoutEntryConsistencyCheck(const_iterator);
+    bool removeIf(NOESCAPE const Invocable<bool(ValueType&)> auto&);
+    void clear();
+
+    static bool isEmptyBucket(const ValueType& value) { return isHashTraitsEmptyValue<KeyTraits>(Extractor::extract(value)); }
+    static bool isEmptyOrDeletedBucket(const ValueType& value) { return isEmptyBucket(value); }
+
+    template<ShouldValidateKey shouldValidateKey> ValueType* lookup(const Key& key) { return lookup<IdentityTranslatorType, shouldValidateKey>(key); }
+    template<typename HashTranslator, ShouldValidateKey, typename T> ValueType* lookup(const T&);
+    template<typename HashTranslator, ShouldValidateKey, typename T> ValueType* inlineLookup(const T&);
+
+#if ASSERT_ENABLED
+        void checkTableConsistency() const;
+#else
+        static void checkTableConsistency() { }
+#endif
+
+#if CHECK_HASHTABLE_CONSISTENCY
+        void internalCheckTableConsistency() const { checkTableConsistency(); }
+        void internalCheckTableConsistencyExceptSize() const { checkTableConsistencyExceptSize(); }
+#else
+        static void internalCheckTableConsistencyExceptSize() { }
+        static void internalCheckTableConsistency() { }
+#endif
+
+    static constexpr bool shouldExpand(uint64_t usedCount, uint64_t tableSize)
+    {
+        return usedCount * maxLoadDenominator > tableSize * maxLoadNumerator;
+    }
+
+private:
+    static constexpr uint8_t emptyControl = 0x80;
+    static constexpr uint8_t deletedControl = 0xfe;
+
+    static constexpr unsigned groupHash(unsigned hash) { return hash >> 7; }
+    static constexpr uint8_t controlHash(unsigned hash) { return hash & 0x7f; }
+    static constexpr bool isFullControl(uint8_t control) { return !(control & 0x80); }
+
+    static ALWAYS_INLINE uint16_t match(simde_uint8x16_t group, uint8_t control) { return SIMD::toBitMask(SIMD::equal(group, SIMD::splat8(control))); }
+    static ALWAYS_INLINE uint16_t matchEmpty(simde_uint8x16_t group) { return match(group, emptyControl); }
+    static ALWAYS_INLINE uint16_t matchEmptyOrDeleted(simde_uint8x16_t group)
+    {
+        constexpr simde_uint8x16_t highBit = SIMD::splat8(0x80);
+        return SIMD::toBitMask(SIMD::equal(SIMD::bitAnd(group, highBit), highBit));
+    }
+
+    // In a table that does not fit in cache, a hit misses twice: once on the control bytes and once on the
+    // bucket. Start loading the group's buckets before matching the control bytes so that the two misses
+    // overlap. We prefetch at most four cache lines, which covers a whole group of 16-byte buckets.
+    static ALWAYS_INLINE void prefetchGroup(const ValueType* buckets)
+    {
+#if COMPILER(GCC_COMPATIBLE)
+        constexpr size_t cacheLineSize = 64;
+        constexpr size_t bytesToPrefetch = std::min<size_t>(groupSize * sizeof(ValueType), 4 * cacheLineSize);
+        for (size_t offset = 0; offset < bytesToPrefetch; offset += cacheLineSize)
+            __builtin_prefetch(reinterpret_cast<const char*>(buckets) + offset);
+#else
+        UNUSED_PARAM(buckets);
+#endif
+    }
+
+    static ValueType* allocateTable(unsigned size);
+    static void deallocateTable(ValueType* table, unsigned size);
+    static uint8_t* controlsForTable(ValueType* table, unsigned size) { return reinterpret_cast<uint8_t*>(table) - size; }
+
+    template<typename HashTranslator, ShouldValidateKey, typename T> void checkKey(const T&);
+    template<typename HashTranslator, typename T> ValueType* lookupForAdd(const T&, unsigned hash, ValueType*& insertionEntry);
+    unsigned findInsertionIndex(unsigned hash) const;
+    template<typename HashTranslator, bool passHashCode> AddResult addImpl(auto&& key, NOESCAPE const std::invocable<> auto& functor);
+
+    void removeAndInvalidateWithoutEntryConsistencyCheck(ValueType*);
+    void removeAndInvalidate(ValueType*);
+    void remove(ValueType*);
+    void removeBucket(ValueType*);
+
+    static constexpr unsigned computeBestTableSize(unsigned keyCount);
+    bool shouldShrink() const { return keyCount() * minLoad < tableSize() && tableSize() > minimumTableSize; }
+    void growForAdd();
+    void shrink() { rehash(tableSize() / 2); }
+    void shrinkToBestSize();
+
+    void rehash(unsigned newTableSize);
+    void reinsert(ValueType&&);
+
+    static void initializeBucket(ValueType& bucket) { initializeHashTableBucket<Traits>(bucket); }
+    static void deleteBucket(ValueType& bucket) { hashTraitsDeleteBucket<Traits>(bucket); }
+
+    iterator makeIterator(ValueType* pos) { return iterator(this, pos, m_table + tableSize()); }
+    const_iterator makeConstIterator(ValueType* pos) const { return const_iterator(this, pos, m_table + tableSize()); }
+    iterator makeKnownGoodIterator(ValueType* pos) { return iterator(this, pos, m_table + tableSize(), HashItemKnownGood); }
+    const_iterator makeKnownGoodConstIterator(ValueType* pos) const { return const_iterator(this, pos, m_table + tableSize(), HashItemKnownGood); }
+
+#if ASSERT_ENABLED
+        void checkTableConsistencyExceptSize() const;
+#else
+        static void checkTableConsistencyExceptSize() { }
+#endif
+
+    static constexpr unsigned maxLoadNumerator = SizePolicy::maxLoadNumerator;
+    static constexpr unsigned maxLoadDenominator = SizePolicy::maxLoadDenominator;
+    static constexpr unsigned minLoad = SizePolicy::minLoad;
+
+    unsigned tableSize() const { return m_tableSize; }
+    unsigned tableSizeMask() const { return m_tableSize - 1; }
+    unsigned groupCountMask() const { return m_tableSize / groupSize - 1; }
+    unsigned keyCount() const { return m_keyCount; }
+    unsigned deletedCount() const { return m_deletedCount; }
+    uint8_t* controls() const { return controlsForTable(m_table, tableSize()); }
+
+    // The control bytes are allocated in front of the buckets, in the same allocation.
+    ValueType* m_table { nullptr };
+    unsigned m_tableSize { 0 };
+    unsigned m_keyCount { 0 };
+    unsigned m_deletedCount { 0 };
+
+#if CHECK_HASHTABLE_ITERATORS
+public:
+    // All access to m_iterators should be guarded with m_mutex.
+    mutable const_iterator* m_iterators { nullptr };
+    // Use std::unique_ptr so HashTable can still be memmove'd or memcpy'ed.
+    mutable std::unique_ptr<Lock> m_mutex { makeUnique<Lock>() };
+#endif
+};
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template<typename HashTranslator, ShouldValidateKey shouldValidateKey, typename T>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::checkKey(const T& key)
+{
+    if constexpr (!ASSERT_ENABLED && shouldValidateKey == ShouldValidateKey::No)
+        return;
+
+    if (!HashFunctions::safeToCompareToEmptyOrDeleted)
+        return;
+    RELEASE_ASSERT(!HashTranslator::equal(KeyTraits::emptyValue(), key));
+    AlignedStorage<ValueType> deletedValueBuffer;
+    auto& deletedValue = *deletedValueBuffer;
+    Traits::constructDeletedValue(deletedValue);
+    RELEASE_ASSERT(!HashTranslator::equal(Extractor::extract(deletedValue), key));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template<typename HashTranslator, ShouldValidateKey shouldValidateKey, typename T>
+inline auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::lookup(const T& key) -> ValueType*
+{
+    return inlineLookup<HashTranslator, shouldValidateKey>(key);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template<typename HashTranslator, ShouldValidateKey shouldValidateKey, typename T>
+ALWAYS_INLINE auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::inlineLookup(const T& key) -> ValueType*
+{
+    checkKey<HashTranslator, shouldValidateKey>(key);
+
+    ValueType* table = m_table;
+    if (!table)
+        return nullptr;
+
+    const uint8_t* controls = this->controls();
+    unsigned groupMask = groupCountMask();
+    unsigned hash = HashTranslator::hash(key);
+    uint8_t control = controlHash(hash);
+    unsigned group = groupHash(hash) & groupMask;
+
+    for (unsigned step = 1; ; ++step) {
+        unsigned offset = group * groupSize;
+        prefetchGroup(table + offset);
+        auto groupControls = SIMD::load(controls + offset);
+        for (uint16_t matches = match(groupControls, control); matches; matches &= matches - 1) {
+            ValueType* entry = table + offset + std::countr_zero(matches);
+            if (HashTranslator::equal(Extractor::extract(*entry), key))
+                return entry;
+        }
+
+        // A group with an empty bucket terminates the probe: an entry would have been put there.
+        if (matchEmpty(groupControls))
+            return nullptr;
+
+        group = (group + step) & groupMask;
+    }
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template<typename HashTranslator, typename T>
+ALWAYS_INLINE auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::lookupForAdd(const T& key, unsigned hash, ValueType*& insertionEntry) -> ValueType*
+{
+    ValueType* table = m_table;
+    const uint8_t* controls = this->controls();
+    unsigned groupMask = groupCountMask();
+    uint8_t control = controlHash(hash);
+    unsigned group = groupHash(hash) & groupMask;
+    insertionEntry = nullptr;
+
+    for (unsigned step = 1; ; ++step) {
+        unsigned offset = group * groupSize;
+        prefetchGroup(table + offset);
+        auto groupControls = SIMD::load(controls + offset);
+        for (uint16_t matches = match(groupControls, control); matches; matches &= matches - 1) {
+            ValueType* entry = table + offset + std::countr_zero(matches);
+            if (HashTranslator::equal(Extractor::extract(*entry), key))
+                return entry;
+        }
+
+        if (!insertionEntry) {
+            if (uint16_t available = matchEmptyOrDeleted(groupControls))
+                insertionEntry = table + offset + std::countr_zero(available);
+        }
+
+        if (matchEmpty(groupControls))
+            return nullptr;
+
+        group = (group + step) & groupMask;
+    }
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+unsigned SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::findInsertionIndex(unsigned hash) const
+{
+    const uint8_t* controls = this->controls();
+    unsigned groupMask = groupCountMask();
+    unsigned group = groupHash(hash) & groupMask;
+
+    for (unsigned step = 1; ; ++step) {
+        unsigned offset = group * groupSize;
+        if (uint16_t available = matchEmptyOrDeleted(SIMD::load(controls + offset)))
+            return offset + std::countr_zero(available);
+        group = (group + step) & groupMask;
+    }
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template<typename HashTranslator, bool passHashCode, typename T>
+ALWAYS_INLINE auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::addImpl(T&& key, NOESCAPE const std::invocable<> auto& functor) -> AddResult
+{
+    invalidateIterators(this);
+
+    if (!m_table)
+        growForAdd();
+
+    internalCheckTableConsistency();
+
+    unsigned hash = HashTranslator::hash(key);
+    ValueType* entry = nullptr;
+    if (ValueType* existingEntry = lookupForAdd<HashTranslator>(key, hash, entry))
+        return AddResult(makeKnownGoodIterator(existingEntry), false);
+
+    ASSERT(entry);
+    unsigned index = entry - m_table;
+    uint8_t* controls = this->controls();
+    if (controls[index] == deletedControl)
+        --m_deletedCount;
+    else if (shouldExpand(keyCount() + deletedCount() + 1, tableSize())) {
+        // Reusing a tombstone never needs to grow the table, but taking an empty bucket may.
+        growForAdd();
+        index = findInsertionIndex(hash);
+        entry = m_table + index;
+        controls = this->controls();
+    }
+
+    controls[index] = controlHash(hash);
+    if constexpr (passHashCode)
+        HashTranslator::translate(*entry, std::forward<T>(key), functor, hash);
+    else
+        HashTranslator::translate(*entry, std::forward<T>(key), functor);
+    m_keyCount += 1;
+
+    internalCheckTableConsistency();
+
+    return AddResult(makeKnownGoodIterator(entry), true);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template<typename HashTranslator, ShouldValidateKey shouldValidateKey, typename T>
+ALWAYS_INLINE auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::add(T&& key, NOESCAPE const std::invocable<> auto& functor) -> AddResult
+{
+    checkKey<HashTranslator, shouldValidateKey>(key);
+    return addImpl<HashTranslator, false>(std::forward<T>(key), functor);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template<typename HashTranslator, ShouldValidateKey shouldValidateKey, typename T>
+inline auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::addPassingHashCode(T&& key, NOESCAPE const std::invocable<> auto& functor) -> AddResult
+{
+    checkKey<HashTranslator, shouldValidateKey>(key);
+    return addImpl<HashTranslator, true>(std::forward<T>(key), functor);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+inline void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::reinsert(ValueType&& value)
+{
+    unsigned hash = IdentityTranslatorType::hash(Extractor::extract(value));
+    unsigned index = findInsertionIndex(hash);
+    ASSERT(controls()[index] == emptyControl);
+    controls()[index] = controlHash(hash);
+    ValueTraits::assignToEmpty(m_table[index], WTFMove(value));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template <typename HashTranslator, ShouldValidateKey shouldValidateKey, typename T>
+auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::find(const T& key) -> iterator
+{
+    if (!m_table)
+        return end();
+
+    ValueType* entry = lookup<HashTranslator, shouldValidateKey>(key);
+    if (!entry)
+        return end();
+
+    return makeKnownGoodIterator(entry);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template <typename HashTranslator, ShouldValidateKey shouldValidateKey, typename T>
+auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::find(const T& key) const -> const_iterator
+{
+    if (!m_table)
+        return end();
+
+    ValueType* entry = const_cast<SwissHashTable*>(this)->lookup<HashTranslator, shouldValidateKey>(key);
+    if (!entry)
+        return end();
+
+    return makeKnownGoodConstIterator(entry);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+template <typename HashTranslator, ShouldValidateKey shouldValidateKey, typename T>
+bool SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::contains(const T& key) const
+{
+    if (!m_table)
+        return false;
+
+    return const_cast<SwissHashTable*>(this)->lookup<HashTranslator, shouldValidateKey>(key);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::removeAndInvalidateWithoutEntryConsistencyCheck(ValueType* pos)
+{
+    invalidateIterators(this);
+    remove(pos);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::removeAndInvalidate(ValueType* pos)
+{
+    invalidateIterators(this);
+    internalCheckTableConsistency();
+    remove(pos);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::removeBucket(ValueType* pos)
+{
+    deleteBucket(*pos);
+    initializeBucket(*pos);
+    m_keyCount -= 1;
+
+    // Empty buckets are only ever consumed between rehashes. So if this group still has one, no probe has
+    // ever continued past this group, and the removed bucket can become empty again instead of a tombstone.
+    unsigned index = pos - m_table;
+    uint8_t* controls = this->controls();
+    if (matchEmpty(SIMD::load(controls + (index & ~(groupSize - 1)))))
+        controls[index] = emptyControl;
+    else {
+        controls[index] = deletedControl;
+        m_deletedCount += 1;
+    }
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::remove(ValueType* pos)
+{
+    removeBucket(pos);
+
+    if (shouldShrink())
+        shrink();
+
+    internalCheckTableConsistency();
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+inline void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::remove(iterator it)
+{
+    if (it == end())
+        return;
+
+    removeAndInvalidate(const_cast<ValueType*>(it.m_iterator.m_position));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+inline void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::removeWithoutEntryConsistencyCheck(iterator it)
+{
+    if (it == end())
+        return;
+
+    removeAndInvalidateWithoutEntryConsistencyCheck(const_cast<ValueType*>(it.m_iterator.m_position));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+inline void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::removeWithoutEntryConsistencyCheck(const_iterator it)
+{
+    if (it == end())
+        return;
+
+    removeAndInvalidateWithoutEntryConsistencyCheck(const_cast<ValueType*>(it.m_position));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+inline void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::remove(const KeyType& key)
+{
+    remove(find<ShouldValidateKey::Yes>(key));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+inline bool SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::removeIf(NOESCAPE const Invocable<bool(ValueType&)> auto& functor)
+{
+    invalidateIterators(this);
+    if (!m_table)
+        return false;
+
+    unsigned removedBucketCount = 0;
+    for (unsigned i = tableSize(); i--;) {
+        ValueType& bucket = m_table[i];
+        if (isEmptyBucket(bucket))
+            continue;
+
+        if (!functor(bucket))
+            continue;
+
+        removeBucket(&bucket);
+        ++removedBucketCount;
+    }
+
+    if (shouldShrink())
+        shrinkToBestSize();
+
+    internalCheckTableConsistency();
+    return removedBucketCount;
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::allocateTable(unsigned size) -> ValueType*
+{
+    ASSERT(!(size % groupSize));
+    size_t controlSize = size * sizeof(uint8_t);
+    uint8_t* controls;
+    ValueType* result;
+    if constexpr (Traits::emptyValueIsZero) {
+        controls = static_cast<uint8_t*>(HashTableMalloc::zeroedMalloc(controlSize + size * sizeof(ValueType)));
+        result = reinterpret_cast_ptr<ValueType*>(controls + controlSize);
+    } else {
+        controls = static_cast<uint8_t*>(HashTableMalloc::malloc(controlSize + size * sizeof(ValueType)));
+        result = reinterpret_cast_ptr<ValueType*>(controls + controlSize);
+        for (unsigned i = 0; i < size; i++)
+            initializeBucket(result[i]);
+    }
+    memset(controls, emptyControl, controlSize);
+    return result;
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::deallocateTable(ValueType* table, unsigned size)
+{
+    for (unsigned i = 0; i < size; ++i)
+        table[i].~ValueType();
+    HashTableMalloc::free(controlsForTable(table, size));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::growForAdd()
+{
+    unsigned oldSize = tableSize();
+    if (!oldSize) {
+        rehash(minimumTableSize);
+        return;
+    }
+
+    // If tombstones take up a quarter of the table, purging them brings the load back to at most 5/8
+    // without allocating a larger table.
+    if (deletedCount() >= oldSize / 4) {
+        rehash(oldSize);
+        return;
+    }
+
+    rehash(oldSize * 2);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+constexpr unsigned SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::computeBestTableSize(unsigned keyCount)
+{
+    unsigned bestTableSize = roundUpToPowerOfTwo(keyCount);
+
+    // Leave room to add a few keys before we have to grow again.
+    if (shouldExpand(static_cast<uint64_t>(keyCount) + keyCount / 8, bestTableSize))
+        bestTableSize *= 2;
+
+    return std::max(bestTableSize, minimumTableSize);
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::shrinkToBestSize()
+{
+    rehash(computeBestTableSize(keyCount()));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::rehash(unsigned newTableSize)
+{
+    internalCheckTableConsistencyExceptSize();
+
+    unsigned oldTableSize = tableSize();
+    ValueType* oldTable = m_table;
+    uint8_t* oldControls = oldTable ? controlsForTable(oldTable, oldTableSize) : nullptr;
+
+    m_table = allocateTable(newTableSize);
+    m_tableSize = newTableSize;
+    m_deletedCount = 0;
+
+    for (unsigned i = 0; i < oldTableSize; ++i) {
+        auto* oldEntry = oldTable + i;
+        if (isFullControl(oldControls[i]))
+            reinsert(WTFMove(*oldEntry));
+        oldEntry->~ValueType();
+    }
+
+    if (oldControls)
+        HashTableMalloc::free(oldControls);
+
+    internalCheckTableConsistency();
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::clear()
+{
+    invalidateIterators(this);
+    if (!m_table)
+        return;
+
+    unsigned oldTableSize = tableSize();
+    m_tableSize = 0;
+    m_keyCount = 0;
+    m_deletedCount = 0;
+    deallocateTable(std::exchange(m_table, nullptr), oldTableSize);
+    internalCheckTableConsistency();
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::SwissHashTable(const SwissHashTable& other)
+{
+    if (!other.m_tableSize || !other.m_keyCount)
+        return;
+
+    unsigned newTableSize = computeBestTableSize(other.m_keyCount);
+    m_table = allocateTable(newTableSize);
+    m_tableSize = newTableSize;
+    m_keyCount = other.m_keyCount;
+    m_deletedCount = 0;
+
+    const uint8_t* otherControls = other.controls();
+    for (unsigned index = 0; index < other.m_tableSize; ++index) {
+        if (isFullControl(otherControls[index])) {
+            ValueType entry(other.m_table[index]);
+            reinsert(WTFMove(entry));
+        }
+    }
+    internalCheckTableConsistency();
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::swap(SwissHashTable& other)
+{
+    using std::swap; // For C++ ADL.
+    invalidateIterators(this);
+    invalidateIterators(&other);
+
+    swap(m_table, other.m_table);
+    swap(m_tableSize, other.m_tableSize);
+    swap(m_keyCount, other.m_keyCount);
+    swap(m_deletedCount, other.m_deletedCount);
+
+    internalCheckTableConsistency();
+    other.internalCheckTableConsistency();
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::operator=(const SwissHashTable& other) -> SwissHashTable&
+{
+    SwissHashTable tmp(other);
+    swap(tmp);
+    return *this;
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+inline SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::SwissHashTable(SwissHashTable&& other)
+{
+    invalidateIterators(&other);
+
+    m_table = std::exchange(other.m_table, nullptr);
+    m_tableSize = std::exchange(other.m_tableSize, 0);
+    m_keyCount = std::exchange(other.m_keyCount, 0);
+    m_deletedCount = std::exchange(other.m_deletedCount, 0);
+
+    internalCheckTableConsistency();
+    other.internalCheckTableConsistency();
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+inline auto SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::operator=(SwissHashTable&& other) -> SwissHashTable&
+{
+    SwissHashTable temp(WTFMove(other));
+    swap(temp);
+    return *this;
+}
+
+#if ASSERT_ENABLED
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::checkTableConsistency() const
+{
+    checkTableConsistencyExceptSize();
+    ASSERT(!m_table || !shouldExpand(keyCount() + deletedCount(), tableSize()));
+}
+
+template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename SizePolicy, typename Malloc>
+void SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, SizePolicy, Malloc>::checkTableConsistencyExceptSize() const
+{
+    if (!m_table)
+        return;
+
+    unsigned count = 0;
+    unsigned deletedCount = 0;
+    const uint8_t* controls = this->controls();
+    unsigned tableSize = this->tableSize();
+    for (unsigned i = 0; i < tableSize; ++i) {
+        ValueType* entry = m_table + i;
+        if (!isFullControl(controls[i])) {
+            ASSERT(isEmptyBucket(*entry));
+            if (controls[i] == deletedControl)
+                ++deletedCount;
+            continue;
+        }
+
+        auto& key = Extractor::extract(*entry);
+        ASSERT(controls[i] == controlHash(IdentityTranslatorType::hash(key)));
+        const_iterator it = find<ShouldValidateKey::No>(key);
+        ASSERT(entry == it.m_position);
+        ++count;
+
+        ValueCheck<Key>::checkConsistency(key);
+    }
+
+    ASSERT(count == keyCount());
+    ASSERT(deletedCount == this->deletedCount());
+    ASSERT(this->tableSize() >= minimumTableSize);
+    ASSERT(tableSizeMask());
+    ASSERT(this->tableSize() == tableSizeMask() + 1);
+}
+
+#endif // ASSERT_ENABLED
+
+struct SwissHashTableTraits {
+    template<typename Key, typename Value, typename Extractor, typename HashFunctions, typename Traits, typename KeyTraits, typename Malloc>
+    using TableType = SwissHashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, DefaultSwissHashTableSizePolicy, Malloc>;
+};
+
+} // namespace WTF
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_END
@@ -55,7 +55,11 @@
 #include <bmalloc/BPlatform.h>
 #if BENABLE(LIBPAS)
 #define USE_LIBPAS_THREAD_SUSPEND_LOCK 1
+#include <bmalloc/pas_scavenger_policy.h>
 #include <bmalloc/pas_thread_suspend_lock.h>
+#if OS(LINUX)
+#include <wtf/linux/CurrentProcessMemoryStatus.h>
+#endif
 #endif
 #if USE(TZONE_MALLOC)
 #if BUSE(TZONE)
@@ -514,6 +518,18 @@ static bool hasDisableTZoneEntitlement()
 #endif
 #endif
 
+#if !USE(SYSTEM_MALLOC) && BENABLE(LIBPAS) && OS(LINUX)
+static bool cgroupMemoryLimit(pas_scavenger_memory_limit_status* status)
+{
+    CgroupMemoryStatus memoryStatus;
+    if (!currentCgroupMemoryStatus(memoryStatus))
+        return false;
+    status->current_bytes = memoryStatus.current;
+    status->limit_bytes = memoryStatus.limit;
+    return true;
+}
+#endif
+
 void initialize()
 {
     static std::once_flag onceKey;
@@ -536,6 +552,10 @@ void initialize()
 #endif
         initializeDates();
         Thread::initializePlatformThreading();
+#if !USE(SYSTEM_MALLOC) && BENABLE(LIBPAS) && OS(LINUX)
+        // Let the scavenger decommit more eagerly as we approach our cgroup memory limit.
+        pas_scavenger_policy_memory_limit_callback = cgroupMemoryLimit;
+#endif
 #if PLATFORM(COCOA)
         initializeLibraryPathDiagnostics();
 #endif
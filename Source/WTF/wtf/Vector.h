@@ -41,6 +41,10 @@
 #include <wtf/ValueCheck.h>
 #include <wtf/VectorTraits.h>
 
+#if ENABLE(VECTOR_ALLOCATION_TRACING)
+#include <wtf/VectorAllocationTracing.h>
+#endif
+
 #if ASAN_ENABLED && __has_include(<sanitizer/asan_interface.h>)
 #include <sanitizer/asan_interface.h>
 #endif
@@ -1410,6 +1414,9 @@ bool Vector<T, inlineCapacity, OverflowHandler, minCapacity, Malloc>::reserveCap
         return true;
     T* oldBuffer = begin();
     T* oldEnd = end();
+#if ENABLE(VECTOR_ALLOCATION_TRACING)
+    size_t oldCapacity = capacity();
+#endif
 
     asanSetBufferSizeToFullCapacity();
 
@@ -1425,8 +1432,14 @@ bool Vector<T, inlineCapacity, OverflowHandler, minCapacity, Malloc>::reserveCap
 
     asanSetInitialBufferSizeTo(size());
 
+#if ENABLE(VECTOR_ALLOCATION_TRACING)
+    uint64_t copyStart = vectorAllocationTracingTimestamp();
+#endif
     TypeOperations::move(oldBuffer, oldEnd, begin());
     Base::deallocateBuffer(oldBuffer);
+#if ENABLE(VECTOR_ALLOCATION_TRACING)
+    recordVectorGrowth({ WTF_PRETTY_FUNCTION, sizeof(T), inlineCapacity, oldCapacity, capacity(), size(), vectorAllocationTracingTimestamp() - copyStart });
+#endif
     return true;
 }
 
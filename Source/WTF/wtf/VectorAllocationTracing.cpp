@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include <wtf/VectorAllocationTracing.h>
+
+#if ENABLE(VECTOR_ALLOCATION_TRACING)
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <wtf/DataLog.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/StackShot.h>
+#include <wtf/StackTrace.h>
+#include <wtf/Vector.h>
+
+namespace WTF {
+
+// The tracer uses Vectors and HashMaps of its own, which must not be traced.
+static thread_local bool isRecording;
+
+namespace {
+
+class IgnoreGrowthScope {
+public:
+    IgnoreGrowthScope()
+        : m_wasRecording(std::exchange(isRecording, true))
+    {
+    }
+
+    ~IgnoreGrowthScope() { isRecording = m_wasRecording; }
+
+    bool wasRecording() const { return m_wasRecording; }
+
+private:
+    bool m_wasRecording;
+};
+
+struct VectorGrowthSite {
+    const char* vectorType { nullptr };
+    size_t elementSize { 0 };
+    size_t inlineCapacity { 0 };
+    uint64_t growths { 0 };
+    uint64_t reallocations { 0 };
+    size_t peakCapacity { 0 };
+    size_t peakSize { 0 };
+    uint64_t bytesCopied { 0 };
+    uint64_t copyNanoseconds { 0 };
+};
+
+class VectorAllocationTracer {
+public:
+    static VectorAllocationTracer& singleton();
+
+    void record(StackShot&&, const VectorGrowth&);
+    void dump();
+
+private:
+    Lock m_lock;
+    HashMap<StackShot, VectorGrowthSite> m_sites WTF_GUARDED_BY_LOCK(m_lock);
+};
+
+VectorAllocationTracer& VectorAllocationTracer::singleton()
+{
+    static LazyNeverDestroyed<VectorAllocationTracer> tracer;
+    static std::once_flag onceKey;
+    std::call_once(onceKey, [&] {
+        tracer.construct();
+        atexit(dumpVectorAllocationTrace);
+    });
+    return tracer;
+}
+
+void VectorAllocationTracer::record(StackShot&& stack, const VectorGrowth& growth)
+{
+    Locker locker { m_lock };
+    auto& site = m_sites.add(WTFMove(stack), VectorGrowthSite { }).iterator->value;
+    site.vectorType = growth.vectorType;
+    site.elementSize = growth.elementSize;
+    site.inlineCapacity = growth.inlineCapacity;
+    site.growths++;
+    // Growing out of the inline buffer, or allocating the first buffer, is not a reallocation.
+    if (growth.oldCapacity > growth.inlineCapacity)
+        site.reallocations++;
+    site.peakCapacity = std::max(site.peakCapacity, growth.newCapacity);
+    site.peakSize = std::max(site.peakSize, growth.size);
+    site.bytesCopied += growth.size * growth.elementSize;
+    site.copyNanoseconds += growth.copyNanoseconds;
+}
+
+static bool isVectorFrame(const char* name)
+{
+    // Only look at the function's qualified name, since the caller's parameters may well be Vectors.
+    const char* parameters = strchr(name, '(');
+    auto containsInName = [&](const char* pattern) {
+        const char* match = strstr(name, pattern);
+        return match && (!parameters || match < parameters);
+    };
+    return containsInName("WTF::Vector<") || containsInName("WTF::VectorBuffer<");
+}
+
+void VectorAllocationTracer::dump()
+{
+    Vector<std::pair<StackShot, VectorGrowthSite>> sites;
+    {
+        Locker locker { m_lock };
+        for (auto& [stack, site] : m_sites)
+            sites.append({ stack, site });
+    }
+
+    std::ranges::sort(sites, [](auto& a, auto& b) {
+        if (a.second.reallocations != b.second.reallocations)
+            return a.second.reallocations > b.second.reallocations;
+        return a.second.copyNanoseconds > b.second.copyNanoseconds;
+    });
+
+    uint64_t totalGrowths = 0;
+    uint64_t totalReallocations = 0;
+    uint64_t totalCopyNanoseconds = 0;
+    for (auto& [stack, site] : sites) {
+        totalGrowths += site.growths;
+        totalReallocations += site.reallocations;
+        totalCopyNanoseconds += site.copyNanoseconds;
+    }
+
+    dataLogLn("Vector allocation trace: ", sites.size(), " sites, ", totalGrowths, " growths, ", totalReallocations, " reallocations, ", totalCopyNanoseconds / 1000, " us copying");
+
+    constexpr size_t sitesToDump = 100;
+    constexpr int callerFramesToDump = 3;
+    for (size_t i = 0; i < std::min(sitesToDump, sites.size()); ++i) {
+        auto& [stack, site] = sites[i];
+        dataLogLn("#", i + 1, ": ", site.reallocations, " reallocations, ", site.growths, " growths, peak capacity ", site.peakCapacity, ", peak size ", site.peakSize,
+            ", inline capacity ", site.inlineCapacity, ", ", site.bytesCopied, " bytes copied in ", site.copyNanoseconds / 1000, " us");
+        dataLogLn("    ", site.vectorType);
+        // The stack starts with the tracer itself, then Vector's growth helpers, then the code that appended.
+        bool sawRecordFrame = false;
+        int callerFrames = 0;
+        StackTraceSymbolResolver { stack.span() }.forEach([&](int, void* pc, const char* name) {
+            if (callerFrames >= callerFramesToDump)
+                return;
+            if (!sawRecordFrame) {
+                sawRecordFrame = name && strstr(name, "recordVectorGrowth");
+                return;
+            }
+            if (name && isVectorFrame(name))
+                return;
+            dataLogLn("    ", RawPointer(pc), " ", name ? name : "?");
+            callerFrames++;
+        });
+        if (!callerFrames)
+            WTFPrintBacktrace(stack.span());
+    }
+}
+
+} // anonymous namespace
+
+uint64_t vectorAllocationTracingTimestamp()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+NEVER_INLINE void recordVectorGrowth(const VectorGrowth& growth)
+{
+    IgnoreGrowthScope ignoreGrowth;
+    if (ignoreGrowth.wasRecording())
+        return;
+
+    // Deep enough to get past Vector's own growth helpers to a few frames of the code that appended.
+    constexpr size_t stackSize = 12;
+    StackShot stack(stackSize);
+    if (!stack)
+        return;
+    VectorAllocationTracer::singleton().record(WTFMove(stack), growth);
+}
+
+void dumpVectorAllocationTrace()
+{
+    IgnoreGrowthScope ignoreGrowth;
+    VectorAllocationTracer::singleton().dump();
+}
+
+} // namespace WTF
+
+#else // ENABLE(VECTOR_ALLOCATION_TRACING)
+
+namespace WTF {
+
+uint64_t vectorAllocationTracingTimestamp()
+{
+    return 0;
+}
+
+void recordVectorGrowth(const VectorGrowth&)
+{
+}
+
+void dumpVectorAllocationTrace()
+{
+}
+
+} // namespace WTF
+
+#endif // ENABLE(VECTOR_ALLOCATION_TRACING)
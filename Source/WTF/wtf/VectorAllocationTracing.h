@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <wtf/ExportMacros.h>
+
+namespace WTF {
+
+// When ENABLE(VECTOR_ALLOCATION_TRACING) is on, every Vector that grows its buffer reports it here. Growths
+// are bucketed by call stack, and a report ranked by how often each site reallocated and how long it spent
+// moving elements is logged at exit. It is meant for picking inline capacities and growth policies, not
+// for shipping: capturing a stack on every growth is slow.
+struct VectorGrowth {
+    const char* vectorType;
+    size_t elementSize;
+    size_t inlineCapacity;
+    size_t oldCapacity;
+    size_t newCapacity;
+    size_t size;
+    uint64_t copyNanoseconds;
+};
+
+WTF_EXPORT_PRIVATE uint64_t vectorAllocationTracingTimestamp();
+WTF_EXPORT_PRIVATE void recordVectorGrowth(const VectorGrowth&);
+WTF_EXPORT_PRIVATE void dumpVectorAllocationTrace();
+
+} // namespace WTF
+
+using WTF::dumpVectorAllocationTrace;
@@ -26,8 +26,11 @@
 #include "config.h"
 #include <wtf/linux/CurrentProcessMemoryStatus.h>
 
+#include <limits.h>
+#include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <wtf/PageBlock.h>
 
@@ -63,4 +66,101 @@ void currentProcessMemoryStatus(ProcessMemoryStatus& memoryStatus)
     memoryStatus.dt = intValue * pageSize;
 }
 
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_BEGIN
+
+static constexpr const char* cgroupMountPoint = "/sys/fs/cgroup";
+
+// Returns the cgroup v2 directory of this process, or nullptr if it is not in a cgroup v2 hierarchy. The
+// cgroup of a process can change, but in practice it does not for the processes we care about.
+static const char* cgroupDirectory()
+{
+    static char directory[PATH_MAX];
+    static bool hasDirectory;
+    static std::once_flag onceFlag;
+    std::call_once(onceFlag, [] {
+        FILE* file = fopen("/proc/self/cgroup", "r");
+        if (!file)
+            return;
+
+        char buffer[PATH_MAX];
+        while (fgets(buffer, sizeof(buffer), file)) {
+            // The cgroup v2 entry is the one with hierarchy ID 0 and no controllers: "0::/path".
+            if (strncmp(buffer, "0::", 3))
+                continue;
+            char* path = buffer + 3;
+            path[strcspn(path, "\n")] = '\0';
+            if (!strcmp(path, "/"))
+                path[0] = '\0';
+            int length = snprintf(directory, sizeof(directory), "%s%s", cgroupMountPoint, path);
+            hasDirectory = length > 0 && static_cast<size_t>(length) < sizeof(directory);
+            break;
+        }
+        fclose(file);
+    });
+    return hasDirectory ? directory : nullptr;
+}
+
+// Returns false if the file cannot be read or holds "max".
+static bool readCgroupValue(const char* directory, const char* fileName, size_t& value)
+{
+    char path[PATH_MAX];
+    int length = snprintf(path, sizeof(path), "%s/%s", directory, fileName);
+    if (length < 0 || static_cast<size_t>(length) >= sizeof(path))
+        return false;
+
+    FILE* file = fopen(path, "r");
+    if (!file)
+        return false;
+
+    char buffer[32];
+    char* line = fgets(buffer, sizeof(buffer), file);
+    fclose(file);
+    if (!line)
+        return false;
+
+    char* end = nullptr;
+    unsigned long long intValue = strtoull(line, &end, 10);
+    if (end == line)
+        return false;
+    value = intValue;
+    return true;
+}
+
+bool currentCgroupMemoryStatus(CgroupMemoryStatus& memoryStatus)
+{
+    const char* directory = cgroupDirectory();
+    if (!directory)
+        return false;
+
+    char buffer[PATH_MAX];
+    strncpy(buffer, directory, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+
+    size_t mountPointLength = strlen(cgroupMountPoint);
+    bool hasLimit = false;
+    size_t leastHeadroom = 0;
+    for (;;) {
+        // The limit of an ancestor applies to us too, and it may well be the tighter one.
+        size_t limit;
+        size_t current;
+        if (readCgroupValue(buffer, "memory.max", limit) && readCgroupValue(buffer, "memory.current", current)) {
+            size_t headroom = current < limit ? limit - current : 0;
+            if (!hasLimit || headroom < leastHeadroom) {
+                hasLimit = true;
+                leastHeadroom = headroom;
+                memoryStatus.current = current;
+                memoryStatus.limit = limit;
+            }
+        }
+
+        char* slash = strrchr(buffer, '/');
+        if (!slash || static_cast<size_t>(slash - buffer) < mountPointLength)
+            break;
+        *slash = '\0';
+    }
+    return hasLimit;
+}
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_END
+
 } // namespace WTF
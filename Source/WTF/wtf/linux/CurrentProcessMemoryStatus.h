@@ -40,7 +40,19 @@ struct ProcessMemoryStatus {
 
 WTF_EXPORT_PRIVATE void currentProcessMemoryStatus(ProcessMemoryStatus&);
 
+struct CgroupMemoryStatus {
+    size_t current { 0 };
+    size_t limit { 0 };
+};
+
+// Reads the cgroup v2 memory.current and memory.max of the cgroup of this process and of its ancestors, and
+// reports the one with the least headroom. Returns false if none of them has a memory limit. This does not
+// allocate with fastMalloc, so it can be called from the libpas scavenger.
+WTF_EXPORT_PRIVATE bool currentCgroupMemoryStatus(CgroupMemoryStatus&);
+
 } // namespace WTF
 
+using WTF::CgroupMemoryStatus;
 using WTF::ProcessMemoryStatus;
+using WTF::currentCgroupMemoryStatus;
 using WTF::currentProcessMemoryStatus;
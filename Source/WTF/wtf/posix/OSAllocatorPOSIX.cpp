@@ -55,6 +55,41 @@
 
 namespace WTF {
 
+static size_t s_transparentHugePageSize;
+
+#if OS(LINUX) && defined(MADV_HUGEPAGE)
+static void adviseTransparentHugePages(void* address, size_t bytes)
+{
+    if (!s_transparentHugePageSize || bytes < s_transparentHugePageSize)
+        return;
+    // This is only a hint. It fails if the kernel has transparent huge pages disabled, which is fine.
+    while (madvise(address, bytes, MADV_HUGEPAGE) == -1 && errno == EAGAIN) { }
+}
+#endif
+
+bool OSAllocator::enableTransparentHugePages()
+{
+#if OS(LINUX) && defined(MADV_HUGEPAGE)
+    FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+    if (!file)
+        return false;
+    size_t hugePageSize = 0;
+    bool success = fscanf(file, "%zu", &hugePageSize) == 1;
+    fclose(file);
+    if (!success || !hasOneBitSet(hugePageSize) || hugePageSize <= pageSize())
+        return false;
+    s_transparentHugePageSize = hugePageSize;
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t OSAllocator::transparentHugePageSize()
+{
+    return s_transparentHugePageSize;
+}
+
 void* OSAllocator::tryReserveAndCommit(size_t bytes, Usage usage, bool writable, bool executable, bool jitCageEnabled, bool includesGuardPages)
 {
     // All POSIX reservations start out logically committed.
@@ -110,8 +145,12 @@ void* OSAllocator::tryReserveUncommitted(size_t bytes, Usage usage, bool writabl
     void* result = mmap(0, bytes, protection, MAP_NORESERVE | MAP_PRIVATE | MAP_ANON, -1, 0);
     if (result == MAP_FAILED)
         result = nullptr;
-    if (result)
+    if (result) {
         while (madvise(result, bytes, MADV_DONTNEED) == -1 && errno == EAGAIN) { }
+#if OS(LINUX) && defined(MADV_HUGEPAGE)
+        adviseTransparentHugePages(result, bytes);
+#endif
+    }
 #else
     void* result = tryReserveAndCommit(bytes, usage, writable, executable, jitCageEnabled, includesGuardPages);
 #if HAVE(MADV_FREE_REUSE)
@@ -137,6 +176,10 @@ void* OSAllocator::tryReserveUncommittedAligned(size_t bytes, size_t alignment,
 {
     ASSERT(hasOneBitSet(alignment) && alignment >= pageSize());
 
+    // Only a huge page aligned range can be backed by huge pages all the way through.
+    if (s_transparentHugePageSize && bytes >= s_transparentHugePageSize)
+        alignment = std::max(alignment, s_transparentHugePageSize);
+
 #if PLATFORM(MAC) || USE(APPLE_INTERNAL_SDK)
     UNUSED_PARAM(usage); // Not supported for mach API.
     ASSERT_UNUSED(includesGuardPages, !includesGuardPages);
@@ -92,6 +92,26 @@ public:
             return -1;
         return static_cast<int>(charPos - subjectPtr);
     }
+
+    // Like findFirstCharacter, but also requires the pattern's last character to line up, which leaves
+    // far fewer candidates to compare. The pattern must have at least two characters.
+    template <typename PatternChar, typename SubjectChar>
+    static inline int findFirstAndLastCharacters(std::span<const PatternChar> pattern, std::span<const SubjectChar> subject, int index)
+    {
+        ASSERT(pattern.size() > 1);
+        PatternChar patternFirstChar = pattern[0];
+        PatternChar patternLastChar = pattern[pattern.size() - 1];
+
+        if constexpr (sizeof(PatternChar) == 2 && sizeof(SubjectChar) == 1) {
+            if (!isLatin1(patternFirstChar) || !isLatin1(patternLastChar))
+                return -1;
+        }
+
+        size_t found = findFirstAndLastCharacter(subject.subspan(index), static_cast<SubjectChar>(patternFirstChar), static_cast<SubjectChar>(patternLastChar), pattern.size() - 1);
+        if (found == notFound)
+            return -1;
+        return index + static_cast<int>(found);
+    }
 };
 
 class AdaptiveStringSearcherTables {
@@ -264,7 +284,7 @@ int AdaptiveStringSearcher<PatternChar, SubjectChar>::linearSearch(AdaptiveStrin
     int i = index;
     int n = subject.size() - patternLength;
     while (i <= n) {
-        i = findFirstCharacter(pattern, subject, i);
+        i = findFirstAndLastCharacters(pattern, subject, i);
         if (i == -1)
             return -1;
         ASSERT(i <= n);
@@ -490,7 +510,7 @@ int AdaptiveStringSearcher<PatternChar, SubjectChar>::initialSearch(AdaptiveStri
     for (int i = index, n = subject.size() - patternLength; i <= n; i++) {
         badness++;
         if (badness <= 0) {
-            i = findFirstCharacter(pattern, subject, i);
+            i = findFirstAndLastCharacters(pattern, subject, i);
             if (i == -1)
                 return -1;
             ASSERT(i <= n);
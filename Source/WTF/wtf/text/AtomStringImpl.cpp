@@ -26,6 +26,7 @@
 
 #include <wtf/Threading.h>
 #include <wtf/text/AtomStringTable.h>
+#include <wtf/text/ConcurrentAtomStringTable.h>
 #include <wtf/text/StringHash.h>
 #include <wtf/unicode/UTF8Conversion.h>
 
@@ -64,15 +65,27 @@ public:
 
 using StringTableImpl = AtomStringTable::StringTableImpl;
 
-static ALWAYS_INLINE StringTableImpl& stringTable()
+static ALWAYS_INLINE AtomStringTable& currentAtomStringTable()
 {
-    return Thread::currentSingleton().atomStringTable()->table();
+    return *Thread::currentSingleton().atomStringTable();
 }
 
 template<typename T, typename HashTranslator>
-static inline Ref<AtomStringImpl> addToStringTable(AtomStringTableLocker&, StringTableImpl& atomStringTable, const T& value)
+static NEVER_INLINE Ref<AtomStringImpl> addToConcurrentStringTable(ConcurrentAtomStringTable& concurrentTable, const T& value)
 {
-    auto addResult = atomStringTable.add<HashTranslator>(value);
+    auto addResult = concurrentTable.add<HashTranslator>(value);
+    if (addResult.isNewEntry)
+        return adoptRef(static_cast<AtomStringImpl&>(*addResult.string));
+    return *static_cast<AtomStringImpl*>(addResult.string);
+}
+
+template<typename T, typename HashTranslator>
+static inline Ref<AtomStringImpl> addToStringTable(AtomStringTableLocker&, AtomStringTable& table, const T& value)
+{
+    if (auto* concurrentTable = table.concurrentTable()) [[unlikely]]
+        return addToConcurrentStringTable<T, HashTranslator>(*concurrentTable, value);
+
+    auto addResult = table.table().add<HashTranslator>(value);
 
     // If the string is newly-translated, then we need to adopt it.
     // The boolean in the pair tells us if that is so.
@@ -85,7 +98,7 @@ template<typename T, typename HashTranslator>
 static inline Ref<AtomStringImpl> addToStringTable(const T& value)
 {
     AtomStringTableLocker locker;
-    return addToStringTable<T, HashTranslator>(locker, stringTable(), value);
+    return addToStringTable<T, HashTranslator>(locker, currentAtomStringTable(), value);
 }
 
 using UCharBuffer = HashTranslatorCharBuffer<UChar>;
@@ -316,7 +329,7 @@ Ref<AtomStringImpl> AtomStringImpl::addLiteral(std::span<const LChar> characters
     return addToStringTable<LCharBuffer, BufferFromStaticDataTranslator<LChar>>(buffer);
 }
 
-static Ref<AtomStringImpl> addSymbol(AtomStringTableLocker& locker, StringTableImpl& atomStringTable, StringImpl& base)
+static Ref<AtomStringImpl> addSymbol(AtomStringTableLocker& locker, AtomStringTable& atomStringTable, StringImpl& base)
 {
     ASSERT(base.length());
     ASSERT(base.isSymbol());
@@ -330,10 +343,10 @@ static Ref<AtomStringImpl> addSymbol(AtomStringTableLocker& locker, StringTableI
 static inline Ref<AtomStringImpl> addSymbol(StringImpl& base)
 {
     AtomStringTableLocker locker;
-    return addSymbol(locker, stringTable(), base);
+    return addSymbol(locker, currentAtomStringTable(), base);
 }
 
-static Ref<AtomStringImpl> addStatic(AtomStringTableLocker& locker, StringTableImpl& atomStringTable, const StringImpl& base)
+static Ref<AtomStringImpl> addStatic(AtomStringTableLocker& locker, AtomStringTable& atomStringTable, const StringImpl& base)
 {
     ASSERT(base.length());
     ASSERT(base.isStatic());
@@ -349,7 +362,7 @@ static Ref<AtomStringImpl> addStatic(AtomStringTableLocker& locker, StringTableI
 static inline Ref<AtomStringImpl> addStatic(const StringImpl& base)
 {
     AtomStringTableLocker locker;
-    return addStatic(locker, stringTable(), base);
+    return addStatic(locker, currentAtomStringTable(), base);
 }
 
 RefPtr<AtomStringImpl> AtomStringImpl::add(const StaticStringImpl* string)
@@ -359,6 +372,32 @@ RefPtr<AtomStringImpl> AtomStringImpl::add(const StaticStringImpl* string)
     return addStatic(*s);
 }
 
+// Atomizes a string which is not an atom yet by putting that very string into the table.
+struct ExistingStringTranslator {
+    static unsigned hash(StringImpl* string) { return string->hash(); }
+    static bool equal(const AtomStringTable::StringEntry& a, StringImpl* b) { return WTF::equal(a.get(), b); }
+    static void translate(AtomStringTable::StringEntry& location, StringImpl* string, unsigned)
+    {
+        string->setIsAtom(true);
+        location = string;
+    }
+};
+
+static Ref<AtomStringImpl> addExistingString(AtomStringTableLocker&, AtomStringTable& table, StringImpl& string)
+{
+    if (auto* concurrentTable = table.concurrentTable()) [[unlikely]]
+        return *static_cast<AtomStringImpl*>(concurrentTable->add<ExistingStringTranslator>(&string).string);
+
+    auto addResult = table.table().add(&string);
+
+    if (addResult.isNewEntry) {
+        ASSERT(addResult.iterator->get() == &string);
+        string.setIsAtom(true);
+    }
+
+    return *static_cast<AtomStringImpl*>(addResult.iterator->get());
+}
+
 Ref<AtomStringImpl> AtomStringImpl::addSlowCase(StringImpl& string)
 {
     // This check is necessary for null symbols.
@@ -375,14 +414,7 @@ Ref<AtomStringImpl> AtomStringImpl::addSlowCase(StringImpl& string)
     ASSERT_WITH_MESSAGE(!string.isAtom(), "AtomStringImpl should not hit the slow case if the string is already an atom.");
 
     AtomStringTableLocker locker;
-    auto addResult = stringTable().add(&string);
-
-    if (addResult.isNewEntry) {
-        ASSERT(addResult.iterator->get() == &string);
-        string.setIsAtom(true);
-    }
-
-    return *static_cast<AtomStringImpl*>(addResult.iterator->get());
+    return addExistingString(locker, currentAtomStringTable(), string);
 }
 
 Ref<AtomStringImpl> AtomStringImpl::addSlowCase(Ref<StringImpl>&& string)
@@ -401,7 +433,11 @@ Ref<AtomStringImpl> AtomStringImpl::addSlowCase(Ref<StringImpl>&& string)
     ASSERT_WITH_MESSAGE(!string->isAtom(), "AtomStringImpl should not hit the slow case if the string is already an atom.");
 
     AtomStringTableLocker locker;
-    auto addResult = stringTable().add(string.ptr());
+    auto& atomStringTable = currentAtomStringTable();
+    if (atomStringTable.concurrentTable()) [[unlikely]]
+        return addExistingString(locker, atomStringTable, string.get());
+
+    auto addResult = atomStringTable.table().add(string.ptr());
 
     if (addResult.isNewEntry) {
         ASSERT(addResult.iterator->get() == string.ptr());
@@ -421,25 +457,18 @@ Ref<AtomStringImpl> AtomStringImpl::addSlowCase(AtomStringTable& stringTable, St
 
     if (string.isStatic()) {
         AtomStringTableLocker locker;
-        return addStatic(locker, stringTable.table(), string);
+        return addStatic(locker, stringTable, string);
     }
 
     if (string.isSymbol()) {
         AtomStringTableLocker locker;
-        return addSymbol(locker, stringTable.table(), string);
+        return addSymbol(locker, stringTable, string);
     }
 
     ASSERT_WITH_MESSAGE(!string.isAtom(), "AtomStringImpl should not hit the slow case if the string is already an atom.");
 
     AtomStringTableLocker locker;
-    auto addResult = stringTable.table().add(&string);
-
-    if (addResult.isNewEntry) {
-        ASSERT(addResult.iterator->get() == &string);
-        string.setIsAtom(true);
-    }
-
-    return *static_cast<AtomStringImpl*>(addResult.iterator->get());
+    return addExistingString(locker, stringTable, string);
 }
 
 // When removing a string from the table, we know it's already the one in the table, so no need for a string equality check.
@@ -452,7 +481,12 @@ void AtomStringImpl::remove(AtomStringImpl* string)
 {
     ASSERT(string->isAtom());
     AtomStringTableLocker locker;
-    auto& atomStringTable = stringTable();
+    if (currentAtomStringTable().concurrentTable()) [[unlikely]] {
+        // Atoms in the concurrent table are never destroyed, so this one must come from some other table.
+        ASSERT_NOT_REACHED_WITH_MESSAGE("The string being removed is an atom in the string table of an other thread!");
+        return;
+    }
+    auto& atomStringTable = currentAtomStringTable().table();
     auto iterator = atomStringTable.find<AtomStringTableRemovalHashTranslator>(string);
     ASSERT_WITH_MESSAGE(iterator != atomStringTable.end(), "The string being removed is an atom in the string table of an other thread!");
     ASSERT(string == iterator->get());
@@ -467,7 +501,10 @@ RefPtr<AtomStringImpl> AtomStringImpl::lookUpSlowCase(StringImpl& string)
         return static_cast<AtomStringImpl*>(StringImpl::empty());
 
     AtomStringTableLocker locker;
-    auto& atomStringTable = stringTable();
+    if (auto* concurrentTable = currentAtomStringTable().concurrentTable()) [[unlikely]]
+        return static_cast<AtomStringImpl*>(concurrentTable->find<ExistingStringTranslator>(&string));
+
+    auto& atomStringTable = currentAtomStringTable().table();
     auto iterator = atomStringTable.find(&string);
     if (iterator != atomStringTable.end())
         return static_cast<AtomStringImpl*>(iterator->get());
@@ -485,9 +522,11 @@ RefPtr<AtomStringImpl> AtomStringImpl::add(std::span<const char8_t> characters)
 RefPtr<AtomStringImpl> AtomStringImpl::lookUp(std::span<const LChar> characters)
 {
     AtomStringTableLocker locker;
-    auto& table = stringTable();
-
     LCharBuffer buffer { characters };
+    if (auto* concurrentTable = currentAtomStringTable().concurrentTable()) [[unlikely]]
+        return static_cast<AtomStringImpl*>(concurrentTable->find<LCharBufferTranslator>(buffer));
+
+    auto& table = currentAtomStringTable().table();
     auto iterator = table.find<LCharBufferTranslator>(buffer);
     if (iterator != table.end())
         return static_cast<AtomStringImpl*>(iterator->get());
@@ -497,9 +536,11 @@ RefPtr<AtomStringImpl> AtomStringImpl::lookUp(std::span<const LChar> characters)
 RefPtr<AtomStringImpl> AtomStringImpl::lookUp(std::span<const UChar> characters)
 {
     AtomStringTableLocker locker;
-    auto& table = stringTable();
-
     UCharBuffer buffer { characters };
+    if (auto* concurrentTable = currentAtomStringTable().concurrentTable()) [[unlikely]]
+        return static_cast<AtomStringImpl*>(concurrentTable->find<UCharBufferTranslator>(buffer));
+
+    auto& table = currentAtomStringTable().table();
     auto iterator = table.find<UCharBufferTranslator>(buffer);
     if (iterator != table.end())
         return static_cast<AtomStringImpl*>(iterator->get());
@@ -510,7 +551,9 @@ RefPtr<AtomStringImpl> AtomStringImpl::lookUp(std::span<const UChar> characters)
 bool AtomStringImpl::isInAtomStringTable(StringImpl* string)
 {
     AtomStringTableLocker locker;
-    return stringTable().contains(string);
+    if (auto* concurrentTable = currentAtomStringTable().concurrentTable())
+        return concurrentTable->contains(string);
+    return currentAtomStringTable().table().contains(string);
 }
 #endif
 
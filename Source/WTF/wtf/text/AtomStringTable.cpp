@@ -23,8 +23,22 @@
 #include "config.h"
 #include <wtf/text/AtomStringTable.h>
 
+#include <mutex>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/ConcurrentAtomStringTable.h>
+
 namespace WTF {
 
+AtomStringTable& AtomStringTable::concurrent()
+{
+    static LazyNeverDestroyed<AtomStringTable> table;
+    static std::once_flag onceKey;
+    std::call_once(onceKey, [&] {
+        table.construct(*new ConcurrentAtomStringTable);
+    });
+    return table.get();
+}
+
 AtomStringTable::~AtomStringTable()
 {
     for (const auto& string : m_table)
@@ -30,6 +30,7 @@
 
 namespace WTF {
 
+class ConcurrentAtomStringTable;
 class StringImpl;
 
 class AtomStringTable {
@@ -40,12 +41,27 @@ public:
     using StringEntry = std::conditional_t<CompactPtrTraits<StringImpl>::is32Bit, CompactPtr<StringImpl>, PackedPtr<StringImpl>>;
     using StringTableImpl = UncheckedKeyHashSet<StringEntry>;
 
+    AtomStringTable() = default;
     WTF_EXPORT_PRIVATE ~AtomStringTable();
 
+    // A process-wide table which any number of threads can use at the same time. A thread opts in with
+    // Thread::currentSingleton().setCurrentAtomStringTable(&AtomStringTable::concurrent()). Atoms created
+    // through it are immortal, so threads using it can share them without going through CrossThreadCopier.
+    WTF_EXPORT_PRIVATE static AtomStringTable& concurrent();
+
+    ConcurrentAtomStringTable* concurrentTable() const { return m_concurrentTable; }
     StringTableImpl& table() { return m_table; }
 
 private:
+    friend class LazyNeverDestroyed<AtomStringTable>;
+
+    explicit AtomStringTable(ConcurrentAtomStringTable& concurrentTable)
+        : m_concurrentTable(&concurrentTable)
+    {
+    }
+
     StringTableImpl m_table;
+    ConcurrentAtomStringTable* m_concurrentTable { nullptr };
 };
 
 }
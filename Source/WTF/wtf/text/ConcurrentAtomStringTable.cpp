@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include <wtf/text/ConcurrentAtomStringTable.h>
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_BEGIN
+
+namespace WTF {
+
+ConcurrentAtomStringTable::ConcurrentAtomStringTable()
+{
+    constexpr unsigned initialSize = 64;
+    for (auto& shard : m_shards) {
+        Locker locker { shard.lock };
+        auto table = Table::create(initialSize);
+        shard.table.storeRelaxed(table.get());
+        shard.allTables.append(WTFMove(table));
+    }
+}
+
+// When checking for a specific string, we know it's the one in the table if it is there at all.
+struct ConcurrentAtomStringTablePointerTranslator {
+    static unsigned hash(StringImpl* string) { return string->existingHash(); }
+    static bool equal(const AtomStringTable::StringEntry& a, StringImpl* b) { return a.get() == b; }
+};
+
+bool ConcurrentAtomStringTable::contains(StringImpl* string) const
+{
+    if (!string->hasHash())
+        return false;
+    return find<ConcurrentAtomStringTablePointerTranslator>(string);
+}
+
+size_t ConcurrentAtomStringTable::size() const
+{
+    size_t result = 0;
+    for (auto& shard : m_shards) {
+        Locker locker { shard.lock };
+        result += shard.keyCount;
+    }
+    return result;
+}
+
+void ConcurrentAtomStringTable::insertNewEntry(Shard& shard, StringImpl* string)
+{
+    Table* table = shard.table.loadRelaxed();
+    if (shard.keyCount + 1 > table->maxLoad()) {
+        // Readers may still be probing the old table, so we fill the new table completely before publishing it,
+        // and keep the old one alive.
+        auto newTable = Table::create(table->size * 2);
+        for (unsigned i = 0; i < table->size; ++i) {
+            StringImpl* entry = table->array[i].loadRelaxed();
+            if (!entry)
+                continue;
+            unsigned index = startIndex(entry->existingHash(), newTable->mask);
+            while (newTable->array[index].loadRelaxed())
+                index = (index + 1) & newTable->mask;
+            newTable->array[index].storeRelaxed(entry);
+        }
+        table = newTable.get();
+        shard.table.store(table, std::memory_order_release);
+        shard.allTables.append(WTFMove(newTable));
+    }
+
+    unsigned index = startIndex(string->existingHash(), table->mask);
+    while (table->array[index].loadRelaxed())
+        index = (index + 1) & table->mask;
+    table->array[index].store(string, std::memory_order_release);
+    ++shard.keyCount;
+}
+
+std::unique_ptr<ConcurrentAtomStringTable::Table> ConcurrentAtomStringTable::Table::create(unsigned size)
+{
+    std::unique_ptr<Table> result(new (fastMalloc(OBJECT_OFFSETOF(Table, array) + sizeof(Atomic<StringImpl*>) * size)) Table());
+    result->size = size;
+    result->mask = size - 1;
+    for (unsigned i = 0; i < size; ++i)
+        result->array[i].storeRelaxed(nullptr);
+    return result;
+}
+
+} // namespace WTF
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_END
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <array>
+#include <wtf/Atomics.h>
+#include <wtf/Lock.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/StdLibExtras.h>
+#include <wtf/Vector.h>
+#include <wtf/text/AtomStringTable.h>
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_BEGIN
+
+namespace WTF {
+
+// This is the backing store of AtomStringTable::concurrent(). It is a set of strings which can be used from
+// any number of threads at once:
+//
+// - Lookups do not take any lock. They probe an insert-only open-addressing table whose entries are
+//   published with release stores.
+// - Additions take the lock of one of numberOfShards shards, selected by the string hash, so threads adding
+//   unrelated strings rarely contend.
+// - Strings are never removed. Each entry holds a reference which is never dropped, which makes the strings
+//   immortal. That is what lets any thread use an atom without racing with its destruction on another thread.
+//
+// When a shard grows, the old table is kept alive since a concurrent reader may still be probing it. Tables
+// double in size, so the retired tables never take more memory than the current one.
+class ConcurrentAtomStringTable final {
+    WTF_MAKE_NONCOPYABLE(ConcurrentAtomStringTable);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    using StringEntry = AtomStringTable::StringEntry;
+
+    static constexpr unsigned numberOfShards = 32;
+
+    WTF_EXPORT_PRIVATE ConcurrentAtomStringTable();
+
+    template<typename HashTranslator, typename T> StringImpl* find(const T&) const;
+
+    struct AddResult {
+        StringImpl* string;
+        bool isNewEntry;
+    };
+    // For a new entry, the reference created by HashTranslator::translate() is handed to the caller and
+    // the table takes one more reference of its own.
+    template<typename HashTranslator, typename T> AddResult add(const T&);
+
+    WTF_EXPORT_PRIVATE bool contains(StringImpl*) const;
+    WTF_EXPORT_PRIVATE size_t size() const;
+
+private:
+    struct Table {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+        static std::unique_ptr<Table> create(unsigned size);
+
+        unsigned maxLoad() const { return size / 2; }
+
+        unsigned size; // This is immutable.
+        unsigned mask; // This is immutable.
+        Atomic<StringImpl*> array[1];
+    };
+
+    struct Shard {
+        Atomic<Table*> table;
+        mutable Lock lock;
+        unsigned keyCount WTF_GUARDED_BY_LOCK(lock) { 0 };
+        Vector<std::unique_ptr<Table>, 4> allTables WTF_GUARDED_BY_LOCK(lock);
+    };
+
+    static unsigned shardIndex(unsigned hash) { return hash & (numberOfShards - 1); }
+    static unsigned startIndex(unsigned hash, unsigned mask) { return (hash / numberOfShards) & mask; }
+
+    const Shard& shardFor(unsigned hash) const { return m_shards[shardIndex(hash)]; }
+    Shard& shardFor(unsigned hash) { return m_shards[shardIndex(hash)]; }
+
+    template<typename HashTranslator, typename T> static StringImpl* findInTable(const Table&, unsigned hash, const T&);
+    template<typename HashTranslator, typename T> AddResult addSlow(Shard&, unsigned hash, const T&);
+    WTF_EXPORT_PRIVATE void insertNewEntry(Shard&, StringImpl*) WTF_REQUIRES_LOCK(shard.lock);
+
+    std::array<Shard, numberOfShards> m_shards;
+};
+
+template<typename HashTranslator, typename T>
+ALWAYS_INLINE StringImpl* ConcurrentAtomStringTable::findInTable(const Table& table, unsigned hash, const T& value)
+{
+    unsigned mask = table.mask;
+    unsigned index = startIndex(hash, mask);
+    for (;;) {
+        // Pairs with the release store in insertNewEntry(), so the string contents are visible.
+        StringImpl* entry = table.array[index].load(std::memory_order_acquire);
+        if (!entry)
+            return nullptr;
+        if (entry->existingHash() == hash && HashTranslator::equal(StringEntry { entry }, value))
+            return entry;
+        index = (index + 1) & mask;
+    }
+}
+
+template<typename HashTranslator, typename T>
+inline StringImpl* ConcurrentAtomStringTable::find(const T& value) const
+{
+    unsigned hash = HashTranslator::hash(value);
+    return findInTable<HashTranslator>(*shardFor(hash).table.load(std::memory_order_acquire), hash, value);
+}
+
+template<typename HashTranslator, typename T>
+inline auto ConcurrentAtomStringTable::add(const T& value) -> AddResult
+{
+    unsigned hash = HashTranslator::hash(value);
+    Shard& shard = shardFor(hash);
+    if (StringImpl* existing = findInTable<HashTranslator>(*shard.table.load(std::memory_order_acquire), hash, value))
+        return { existing, false };
+    return addSlow<HashTranslator>(shard, hash, value);
+}
+
+template<typename HashTranslator, typename T>
+NEVER_INLINE auto ConcurrentAtomStringTable::addSlow(Shard& shard, unsigned hash, const T& value) -> AddResult
+{
+    Locker locker { shard.lock };
+
+    // Another thread may have added the string since we looked, possibly into a table grown in the meantime.
+    if (StringImpl* existing = findInTable<HashTranslator>(*shard.table.loadRelaxed(), hash, value))
+        return { existing, false };
+
+    StringEntry location;
+    HashTranslator::translate(location, value, hash);
+    StringImpl* string = location.get();
+    ASSERT(string->isAtom());
+    ASSERT(string->existingHash() == hash);
+    string->ref();
+    insertNewEntry(shard, string);
+    return { string, true };
+}
+
+} // namespace WTF
+
+using WTF::ConcurrentAtomStringTable;
+
+WTF_ALLOW_UNSAFE_BUFFER_USAGE_END
@@ -484,8 +484,45 @@ inline size_t findIgnoringASCIICaseWithoutLength(const char* source, const char*
     return matchSpan.size() <= searchSpan.size() ? findIgnoringASCIICase(searchSpan, matchSpan, 0) : notFound;
 }
 
+template<typename UnsignedType>
+ALWAYS_INLINE size_t findFirstAndLastCharacterImpl(const UnsignedType* pointer, size_t length, UnsignedType firstCharacter, UnsignedType lastCharacter, size_t lastOffset)
+{
+    constexpr size_t stride = SIMD::stride<UnsignedType>;
+    auto firstCharactersVector = SIMD::splat<UnsignedType>(firstCharacter);
+    auto lastCharactersVector = SIMD::splat<UnsignedType>(lastCharacter);
+
+    size_t index = 0;
+    for (; index + stride <= length; index += stride) {
+        auto firstMask = SIMD::equal(SIMD::load(pointer + index), firstCharactersVector);
+        auto lastMask = SIMD::equal(SIMD::load(pointer + index + lastOffset), lastCharactersVector);
+        if (auto lane = SIMD::findFirstNonZeroIndex(SIMD::bitAnd(firstMask, lastMask)))
+            return index + *lane;
+    }
+    for (; index < length; ++index) {
+        if (pointer[index] == firstCharacter && pointer[index + lastOffset] == lastCharacter)
+            return index;
+    }
+    return notFound;
+}
+
+// Returns the first index at which firstCharacter occurs with lastCharacter lastOffset characters later, or notFound.
+// Substring searches use this to skip to the candidates worth comparing in full; requiring the last character
+// as well rejects far more positions than looking for the first character alone.
+template<typename CharacterType>
+ALWAYS_INLINE size_t findFirstAndLastCharacter(std::span<const CharacterType> characters, CharacterType firstCharacter, CharacterType lastCharacter, size_t lastOffset)
+{
+    ASSERT(lastOffset < characters.size());
+    size_t length = characters.size() - lastOffset;
+    if constexpr (sizeof(CharacterType) == 1)
+        return findFirstAndLastCharacterImpl(std::bit_cast<const uint8_t*>(characters.data()), length, static_cast<uint8_t>(firstCharacter), static_cast<uint8_t>(lastCharacter), lastOffset);
+    else {
+        static_assert(sizeof(CharacterType) == 2);
+        return findFirstAndLastCharacterImpl(std::bit_cast<const uint16_t*>(characters.data()), length, static_cast<uint16_t>(firstCharacter), static_cast<uint16_t>(lastCharacter), lastOffset);
+    }
+}
+
 template <typename SearchCharacterType, typename MatchCharacterType>
-ALWAYS_INLINE static size_t findInner(std::span<const SearchCharacterType> searchCharacters, std::span<const MatchCharacterType> matchCharacters, size_t index)
+ALWAYS_INLINE static size_t findInnerWithRollingHash(std::span<const SearchCharacterType> searchCharacters, std::span<const MatchCharacterType> matchCharacters, size_t index)
 {
     // Optimization: keep a running hash of the strings,
     // only call equal() if the hashes match.
@@ -513,6 +550,38 @@ ALWAYS_INLINE static size_t findInner(std::span<const SearchCharacterType> searc
     return index + i;
 }
 
+template <typename SearchCharacterType, typename MatchCharacterType>
+ALWAYS_INLINE static size_t findInner(std::span<const SearchCharacterType> searchCharacters, std::span<const MatchCharacterType> matchCharacters, size_t index)
+{
+    if constexpr (sizeof(MatchCharacterType) > sizeof(SearchCharacterType))
+        return findInnerWithRollingHash(searchCharacters, matchCharacters, index);
+    else {
+        // delta is the number of additional times to test; delta == 0 means test only once.
+        size_t delta = searchCharacters.size() - matchCharacters.size();
+        size_t lastOffset = matchCharacters.size() - 1;
+        auto firstCharacter = static_cast<SearchCharacterType>(matchCharacters.front());
+        auto lastCharacter = static_cast<SearchCharacterType>(matchCharacters.back());
+
+        // Each rejected candidate costs a comparison of up to the whole match. Text where the first and last
+        // characters keep lining up (e.g. runs of one character) would make that quadratic, so hand those
+        // over to the rolling hash.
+        size_t rejectedCandidates = 0;
+        for (size_t i = 0; i <= delta; ++i) {
+            size_t candidate = findFirstAndLastCharacter(searchCharacters.subspan(i), firstCharacter, lastCharacter, lastOffset);
+            if (candidate == notFound)
+                return notFound;
+            i += candidate;
+            if (equal(searchCharacters.data() + i, matchCharacters))
+                return index + i;
+            if (i == delta)
+                return notFound;
+            if (++rejectedCandidates > 16 + i / 8)
+                return findInnerWithRollingHash(searchCharacters.subspan(i + 1), matchCharacters, index + i + 1);
+        }
+        return notFound;
+    }
+}
+
 ALWAYS_INLINE const uint8_t* find8(const uint8_t* pointer, uint8_t character, size_t length)
 {
     constexpr size_t thresholdLength = 16;
@@ -601,11 +670,22 @@ ALWAYS_INLINE const float* findFloat(const float* pointer, float target, size_t
 #else
 ALWAYS_INLINE const float* findFloat(const float* pointer, float target, size_t length)
 {
-    for (size_t index = 0; index < length; ++index) {
-        if (pointer[index] == target)
-            return pointer + index;
-    }
-    return nullptr;
+    // Lanes are compared as floats, so NaN never matches and +0 matches -0, just like the scalar loop.
+    auto targetsVector = simde_vdupq_n_f32(target);
+    auto vectorMatch = [&](simde_uint32x4_t value) ALWAYS_INLINE_LAMBDA {
+        return SIMD::findFirstNonZeroIndex(simde_vceqq_f32(simde_vreinterpretq_f32_u32(value), targetsVector));
+    };
+
+    auto scalarMatch = [&](uint32_t value) ALWAYS_INLINE_LAMBDA {
+        return std::bit_cast<float>(value) == target;
+    };
+
+    constexpr size_t threshold = 32;
+    auto* bits = std::bit_cast<const uint32_t*>(pointer);
+    auto* cursor = SIMD::find<uint32_t, threshold>(std::span { bits, length }, vectorMatch, scalarMatch);
+    if (cursor == bits + length)
+        return nullptr;
+    return std::bit_cast<const float*>(cursor);
 }
 #endif
 
@@ -634,14 +714,63 @@ ALWAYS_INLINE const double* findDouble(const double* pointer, double target, siz
 #else
 ALWAYS_INLINE const double* findDouble(const double* pointer, double target, size_t length)
 {
-    for (size_t index = 0; index < length; ++index) {
-        if (pointer[index] == target)
-            return pointer + index;
-    }
-    return nullptr;
+    auto targetsVector = simde_vdupq_n_f64(target);
+    auto vectorMatch = [&](simde_uint64x2_t value) ALWAYS_INLINE_LAMBDA {
+        return SIMD::findFirstNonZeroIndex(simde_vceqq_f64(simde_vreinterpretq_f64_u64(value), targetsVector));
+    };
+
+    auto scalarMatch = [&](uint64_t value) ALWAYS_INLINE_LAMBDA {
+        return std::bit_cast<double>(value) == target;
+    };
+
+    constexpr size_t threshold = 32;
+    auto* bits = std::bit_cast<const uint64_t*>(pointer);
+    auto* cursor = SIMD::find<uint64_t, threshold>(std::span { bits, length }, vectorMatch, scalarMatch);
+    if (cursor == bits + length)
+        return nullptr;
+    return std::bit_cast<const double*>(cursor);
 }
 #endif
 
+// NaN is the only value that does not compare equal to itself, so these look for lanes where that fails.
+ALWAYS_INLINE const float* findFloatNaN(const float* pointer, size_t length)
+{
+    auto vectorMatch = [&](simde_uint32x4_t value) ALWAYS_INLINE_LAMBDA {
+        auto floats = simde_vreinterpretq_f32_u32(value);
+        return SIMD::findFirstNonZeroIndex(SIMD::bitNot(simde_vceqq_f32(floats, floats)));
+    };
+
+    auto scalarMatch = [&](uint32_t value) ALWAYS_INLINE_LAMBDA {
+        return std::isnan(std::bit_cast<float>(value));
+    };
+
+    constexpr size_t threshold = 32;
+    auto* bits = std::bit_cast<const uint32_t*>(pointer);
+    auto* cursor = SIMD::find<uint32_t, threshold>(std::span { bits, length }, vectorMatch, scalarMatch);
+    if (cursor == bits + length)
+        return nullptr;
+    return std::bit_cast<const float*>(cursor);
+}
+
+ALWAYS_INLINE const double* findDoubleNaN(const double* pointer, size_t length)
+{
+    auto vectorMatch = [&](simde_uint64x2_t value) ALWAYS_INLINE_LAMBDA {
+        auto doubles = simde_vreinterpretq_f64_u64(value);
+        return SIMD::findFirstNonZeroIndex(SIMD::bitNot(simde_vceqq_f64(doubles, doubles)));
+    };
+
+    auto scalarMatch = [&](uint64_t value) ALWAYS_INLINE_LAMBDA {
+        return std::isnan(std::bit_cast<double>(value));
+    };
+
+    constexpr size_t threshold = 32;
+    auto* bits = std::bit_cast<const uint64_t*>(pointer);
+    auto* cursor = SIMD::find<uint64_t, threshold>(std::span { bits, length }, vectorMatch, scalarMatch);
+    if (cursor == bits + length)
+        return nullptr;
+    return std::bit_cast<const double*>(cursor);
+}
+
 WTF_EXPORT_PRIVATE const LChar* find8NonASCIIAlignedImpl(std::span<const LChar>);
 WTF_EXPORT_PRIVATE const UChar* find16NonASCIIAlignedImpl(std::span<const UChar>);
 
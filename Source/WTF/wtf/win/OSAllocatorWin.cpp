@@ -134,6 +134,16 @@ void OSAllocator::hintMemoryNotNeededSoon(void*, size_t)
 {
 }
 
+bool OSAllocator::enableTransparentHugePages()
+{
+    return false;
+}
+
+size_t OSAllocator::transparentHugePageSize()
+{
+    return 0;
+}
+
 bool OSAllocator::tryProtect(void* address, size_t bytes, bool readable, bool writable)
 {
     if (!bytes)
@@ -1375,6 +1375,13 @@ private:
 
     JSValue getProperty(JSObject* object, const Identifier& propertyName)
     {
+        // Plain data objects make up most large messages. Without accessors, [[Get]] of an own named
+        // property is just a load from the object's property storage.
+        if (object->classInfo() == JSFinalObject::info() && !object->structure()->hasAnyKindOfGetterSetterProperties()) {
+            if (JSValue value = object->getDirect(m_lexicalGlobalObject->vm(), propertyName))
+                return value;
+        }
+
         PropertySlot slot(object, PropertySlot::InternalMethodType::Get);
         if (object->methodTable()->getOwnPropertySlot(object, m_lexicalGlobalObject, propertyName, slot))
             return slot.getValue(m_lexicalGlobalObject, propertyName);
@@ -3399,6 +3406,36 @@ private:
         propertyNameStack.removeLast();
     }
 
+    // Sibling objects in a message, like the elements of an array of records, usually have the same shape.
+    // Giving a new object the inline capacity of its previous sibling keeps records with more properties
+    // than the default inline capacity from growing an out-of-line butterfly. Objects at the same depth
+    // under different parents often differ, so a hint only applies to children of the same parent. Every
+    // parent is kept alive by the object pool, so its address cannot be reused for another one meanwhile.
+    unsigned objectInlineCapacityHint(const MarkedVector<JSObject*, 32>& outputObjectStack) const
+    {
+        size_t depth = outputObjectStack.size();
+        JSObject* parent = depth ? outputObjectStack.last() : nullptr;
+        if (depth < m_objectInlineCapacityHints.size() && m_objectInlineCapacityHints[depth].parent == parent)
+            return m_objectInlineCapacityHints[depth].inlineCapacity;
+        return JSFinalObject::defaultInlineCapacity;
+    }
+
+    void didDeserializeObject(const MarkedVector<JSObject*, 32>& outputObjectStack, JSValue value)
+    {
+        auto* object = jsDynamicCast<JSFinalObject*>(value);
+        if (!object)
+            return;
+        Structure* structure = object->structure();
+        unsigned propertyCount = structure->inlineSize() + structure->outOfLineSize();
+        size_t depth = outputObjectStack.size();
+        if (m_objectInlineCapacityHints.size() <= depth)
+            m_objectInlineCapacityHints.grow(depth + 1);
+        m_objectInlineCapacityHints[depth] = {
+            depth ? outputObjectStack.last() : nullptr,
+            std::clamp<unsigned>(propertyCount, JSFinalObject::defaultInlineCapacity, JSFinalObject::maxInlineCapacity)
+        };
+    }
+
     DeserializationResult deserialize();
 
     Vector<std::optional<DetachedImageBitmap>> takeDetachedImageBitmaps() { return std::exchange(m_detachedImageBitmaps, { }); }
@@ -5455,6 +5492,11 @@ private:
     unsigned m_majorVersion;
     unsigned m_minorVersion;
     Vector<CachedString> m_constantPool;
+    struct ObjectInlineCapacityHint {
+        JSObject* parent { nullptr };
+        unsigned inlineCapacity { JSFinalObject::defaultInlineCapacity };
+    };
+    Vector<ObjectInlineCapacityHint, 16> m_objectInlineCapacityHints;
     Vector<Ref<ImageData>> m_imageDataPool;
     const Vector<Ref<MessagePort>>& m_messagePorts;
     ArrayBufferContentsArray* m_arrayBufferContents;
@@ -5638,7 +5680,7 @@ DeserializationResult CloneDeserializer::deserialize()
         case ObjectStartState: {
             if (outputObjectStack.size() > maximumFilterRecursion)
                 return std::make_pair(JSValue(), SerializationReturnCode::StackOverflowError);
-            JSObject* outObject = constructEmptyObject(m_lexicalGlobalObject, m_globalObject->objectPrototype());
+            JSObject* outObject = constructEmptyObject(m_lexicalGlobalObject, m_globalObject->objectPrototype(), objectInlineCapacityHint(outputObjectStack));
             addToObjectPool<ObjectTag>(outObject);
             outputObjectStack.append(outObject);
         }
@@ -5649,6 +5691,7 @@ DeserializationResult CloneDeserializer::deserialize()
             case VisitNamedMemberResult::Error:
                 goto error;
             case VisitNamedMemberResult::Break:
+                didDeserializeObject(outputObjectStack, outValue);
                 break;
             case VisitNamedMemberResult::Start:
                 goto startVisitNamedMember;
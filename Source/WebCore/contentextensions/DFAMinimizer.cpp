@@ -33,6 +33,7 @@
 #include "MutableRangeList.h"
 #include <wtf/HashMap.h>
 #include <wtf/Hasher.h>
+#include <wtf/ParallelAlgorithms.h>
 #include <wtf/Vector.h>
 
 namespace WebCore {
@@ -475,27 +476,36 @@ void DFAMinimizer::minimize(DFA& dfa)
 
     Vector<unsigned> relocationVector(dfa.nodes.size(), [](size_t i) { return i; });
 
-    // Update all the transitions.
-    for (unsigned i = 0; i < dfa.nodes.size(); ++i) {
-        unsigned replacement = fullGraphPartition.nodeReplacement(i);
-        if (i != replacement) {
-            relocationVector[i] = replacement;
-            dfa.nodes[i].kill(dfa);
+    // Each node only touches its own slots in relocationVector and its own transitions, so both passes can
+    // run in parallel. The second pass relies on every replaced node having been killed by the first.
+    static constexpr size_t nodesPerChunk = 4096;
+    parallelFor(0, dfa.nodes.size(), nodesPerChunk, [&](size_t begin, size_t end) {
+        for (unsigned i = static_cast<unsigned>(begin); i < end; ++i) {
+            unsigned replacement = fullGraphPartition.nodeReplacement(i);
+            if (i != replacement) {
+                relocationVector[i] = replacement;
+                dfa.nodes[i].kill(dfa);
+            }
         }
-    }
+    });
 
     dfa.root = relocationVector[dfa.root];
-    for (DFANode& node : dfa.nodes) {
-        if (node.isKilled())
-            continue;
-
-        for (auto& transition : node.transitions(dfa)) {
-            uint32_t target = transition.target();
-            uint32_t relocatedTarget = relocationVector[target];
-            if (target != relocatedTarget)
-                transition.resetTarget(relocatedTarget);
+
+    // Update all the transitions.
+    parallelFor(0, dfa.nodes.size(), nodesPerChunk, [&](size_t begin, size_t end) {
+        for (unsigned i = static_cast<unsigned>(begin); i < end; ++i) {
+            DFANode& node = dfa.nodes[i];
+            if (node.isKilled())
+                continue;
+
+            for (auto& transition : node.transitions(dfa)) {
+                uint32_t target = transition.target();
+                uint32_t relocatedTarget = relocationVector[target];
+                if (target != relocatedTarget)
+                    transition.resetTarget(relocatedTarget);
+            }
         }
-    }
+    });
 }
 
 } // namespace ContentExtensions
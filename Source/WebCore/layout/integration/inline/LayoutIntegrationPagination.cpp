@@ -51,10 +51,10 @@ static LayoutUnit computeFirstLineSnapAdjustment(const InlineDisplay::Line& line
     return lineGrid.paginationOrigin.value_or(LayoutSize { }).height() + firstBaselinePosition - baseline;
 }
 
-std::pair<Vector<LineAdjustment>, std::optional<LayoutRestartLine>> computeAdjustmentsForPagination(const InlineContent& inlineContent, const Layout::PlacedFloats& placedFloats, bool allowLayoutRestart, const Layout::BlockLayoutState& blockLayoutState, RenderBlockFlow& flow)
+std::pair<LineAdjustments, std::optional<LayoutRestartLine>> computeAdjustmentsForPagination(const InlineContent& inlineContent, const Layout::PlacedFloats& placedFloats, bool allowLayoutRestart, const Layout::BlockLayoutState& blockLayoutState, RenderBlockFlow& flow)
 {
     auto lineCount = inlineContent.displayContent().lines.size();
-    Vector<LineAdjustment> adjustments { lineCount };
+    LineAdjustments adjustments { lineCount };
 
     UncheckedKeyHashMap<size_t, LayoutUnit, DefaultHash<size_t>, WTF::UnsignedWithZeroKeyHashTraits<size_t>>  lineFloatBottomMap;
     for (auto& floatBox : placedFloats.list()) {
@@ -152,10 +152,10 @@ std::pair<Vector<LineAdjustment>, std::optional<LayoutRestartLine>> computeAdjus
     if (!previousPageBreakIndex)
         return { };
 
-    return { adjustments, layoutRestartLine };
+    return { WTFMove(adjustments), layoutRestartLine };
 }
 
-void adjustLinePositionsForPagination(InlineContent& inlineContent, const Vector<LineAdjustment>& adjustments)
+void adjustLinePositionsForPagination(InlineContent& inlineContent, const LineAdjustments& adjustments)
 {
     if (adjustments.isEmpty())
         return;
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "LayoutIntegrationInlineContent.h"
+#include <wtf/BumpArena.h>
 
 namespace WebCore {
 
@@ -48,8 +49,11 @@ struct LayoutRestartLine {
     LayoutUnit offset;
 };
 
-std::pair<Vector<LineAdjustment>, std::optional<LayoutRestartLine>> computeAdjustmentsForPagination(const InlineContent&, const Layout::PlacedFloats&, bool allowLayoutRestart, const Layout::BlockLayoutState&, RenderBlockFlow&);
-void adjustLinePositionsForPagination(InlineContent&, const Vector<LineAdjustment>&);
+// These only live for one line layout pass, so they come from the layout scratch arena.
+using LineAdjustments = Vector<LineAdjustment, 0, CrashOnOverflow, 16, BumpArenaMalloc>;
+
+std::pair<LineAdjustments, std::optional<LayoutRestartLine>> computeAdjustmentsForPagination(const InlineContent&, const Layout::PlacedFloats&, bool allowLayoutRestart, const Layout::BlockLayoutState&, RenderBlockFlow&);
+void adjustLinePositionsForPagination(InlineContent&, const LineAdjustments&);
 
 }
 }
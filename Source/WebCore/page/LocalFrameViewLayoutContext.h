@@ -28,6 +28,7 @@
 #include "LayoutUnit.h"
 #include "RenderLayerModelObject.h"
 #include "Timer.h"
+#include <wtf/BumpArena.h>
 #include <wtf/CheckedRef.h>
 #include <wtf/SegmentedVector.h>
 #include <wtf/TZoneMalloc.h>
@@ -161,6 +162,9 @@ public:
     bool addToDetachedRendererList(RenderPtr<RenderObject>&& renderer) const { return m_detachedRendererList.append(WTFMove(renderer)); }
     void deleteDetachedRenderersNow() const { m_detachedRendererList.clear(); }
 
+    // Scratch memory for laying out one formatting context. See LayoutIntegration::LineLayout::layout().
+    BumpArena& scratchArena() { return m_scratchArena; }
+
 private:
     friend class LayoutScope;
     friend class LayoutStateMaintainer;
@@ -274,6 +278,8 @@ private:
         SegmentedVector<std::unique_ptr<RenderObject>, 50> m_renderers;
     };
     mutable DetachedRendererList m_detachedRendererList;
+
+    BumpArena m_scratchArena;
 };
 
 } // namespace WebCore
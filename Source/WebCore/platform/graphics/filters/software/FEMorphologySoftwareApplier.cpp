@@ -28,7 +28,7 @@
 #include "FEMorphology.h"
 #include "Filter.h"
 #include "PixelBuffer.h"
-#include <wtf/ParallelJobs.h>
+#include <wtf/ParallelAlgorithms.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/TZoneMallocInlines.h>
 
@@ -106,43 +106,20 @@ void FEMorphologySoftwareApplier::applyPlatformGeneric(const PaintingData& paint
     }
 }
 
-void FEMorphologySoftwareApplier::applyPlatformWorker(ApplyParameters* params)
-{
-    applyPlatformGeneric(*params->paintingData, params->startY, params->endY);
-}
-
 void FEMorphologySoftwareApplier::applyPlatform(const PaintingData& paintingData)
 {
     // Empirically, runtime is approximately linear over reasonable kernel sizes with a slope of about 0.65.
     float kernelFactor = sqrt(paintingData.radiusX * paintingData.radiusY) * 0.65;
 
     static const int minimalArea = (160 * 160); // Empirical data limit for parallel jobs
-    
-    unsigned maxNumThreads = paintingData.height / 8;
-    unsigned optimalThreadNumber = std::min<unsigned>((paintingData.width * paintingData.height * kernelFactor) / minimalArea, maxNumThreads);
-    if (optimalThreadNumber > 1) {
-        ParallelJobs<ApplyParameters> parallelJobs(&applyPlatformWorker, optimalThreadNumber);
-        auto numOfThreads = parallelJobs.numberOfJobs();
-        if (numOfThreads > 1) {
-            // Split the job into "jobSize"-sized jobs but there a few jobs that need to be slightly larger since
-            // jobSize * jobs < total size. These extras are handled by the remainder "jobsWithExtra".
-            int jobSize = paintingData.height / numOfThreads;
-            int jobsWithExtra = paintingData.height % numOfThreads;
-            int currentY = 0;
-            for (int job = numOfThreads - 1; job >= 0; --job) {
-                ApplyParameters& param = parallelJobs.parameter(job);
-                param.startY = currentY;
-                currentY += job < jobsWithExtra ? jobSize + 1 : jobSize;
-                param.endY = currentY;
-                param.paintingData = &paintingData;
-            }
-            parallelJobs.execute();
-            return;
-        }
-        // Fallback to single thread model
-    }
 
-    applyPlatformGeneric(paintingData, 0, paintingData.height);
+    // Give each chunk at least minimalArea worth of work, and at least 8 rows. Images that fit in one chunk
+    // are filtered on this thread.
+    float rowCost = std::max(paintingData.width * kernelFactor, 1.0f);
+    size_t rowsPerChunk = std::max<size_t>(static_cast<size_t>(minimalArea / rowCost), 8);
+    parallelFor(0, paintingData.height, rowsPerChunk, [&](size_t startY, size_t endY) {
+        applyPlatformGeneric(paintingData, static_cast<int>(startY), static_cast<int>(endY));
+    });
 }
 
 bool FEMorphologySoftwareApplier::apply(const Filter& filter, std::span<const Ref<FilterImage>> inputs, FilterImage& result) const
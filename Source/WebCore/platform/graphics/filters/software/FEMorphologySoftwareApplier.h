@@ -56,12 +56,6 @@ private:
         int height;
     };
 
-    struct ApplyParameters {
-        const PaintingData* paintingData;
-        int startY;
-        int endY;
-    };
-
     static inline int pixelArrayIndex(int x, int y, int width) { return (y * width + x) * 4; }
     static inline PackedColor::RGBA makePixelValueFromColorComponents(const ColorComponents<uint8_t, 4>& components) { return PackedColor::RGBA { makeFromComponents<SRGBA<uint8_t>>(components) }; }
 
@@ -71,7 +65,6 @@ private:
     static inline ColorComponents<uint8_t, 4> kernelExtremum(const ColumnExtrema& kernel, MorphologyOperatorType);
 
     static void applyPlatformGeneric(const PaintingData&, int startY, int endY);
-    static void applyPlatformWorker(ApplyParameters*);
     static void applyPlatform(const PaintingData&);
 };
 
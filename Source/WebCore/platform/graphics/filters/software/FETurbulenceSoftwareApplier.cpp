@@ -30,7 +30,7 @@
 #include "Filter.h"
 #include "PixelBuffer.h"
 #include <wtf/MathExtras.h>
-#include <wtf/ParallelJobs.h>
+#include <wtf/ParallelAlgorithms.h>
 #include <wtf/TZoneMallocInlines.h>
 
 namespace WebCore {
@@ -294,52 +294,16 @@ void FETurbulenceSoftwareApplier::applyPlatformGeneric(const IntRect& filterRegi
     }
 }
 
-void FETurbulenceSoftwareApplier::applyPlatformWorker(ApplyParameters* parameters)
-{
-    applyPlatformGeneric(parameters->filterRegion, parameters->filterScale, Ref { *parameters->pixelBuffer }, *parameters->paintingData, parameters->stitchData, parameters->startY, parameters->endY);
-}
-
 void FETurbulenceSoftwareApplier::applyPlatform(const IntRect& filterRegion, const FloatSize& filterScale, PixelBuffer& pixelBuffer, PaintingData& paintingData, StitchData& stitchData)
 {
-    int height = filterRegion.height();
-    unsigned area = filterRegion.area();
-
     static const int minimalRectDimension = (100 * 100); // Empirical data limit for parallel jobs.
-    unsigned maxNumThreads = filterRegion.height() / 8;
-    unsigned optimalThreadNumber = std::min<unsigned>(area / minimalRectDimension, maxNumThreads);
-
-    if (optimalThreadNumber > 1) {
-        ParallelJobs<ApplyParameters> parallelJobs(&applyPlatformWorker, optimalThreadNumber);
-
-        // Fill the parameter array
-        auto numJobs = parallelJobs.numberOfJobs();
-        if (numJobs > 1) {
-            // Split the job into "stepY"-sized jobs, distributing the extra rows into the first "jobsWithExtra" jobs.
-            unsigned stepY = height / numJobs;
-            unsigned jobsWithExtra = height % numJobs;
-            unsigned startY = 0;
-
-            for (unsigned i = 0; i < numJobs; ++i) {
-                ApplyParameters& params = parallelJobs.parameter(i);
-                params.filterRegion = filterRegion;
-                params.filterScale = filterScale;
-                params.pixelBuffer = pixelBuffer;
-                params.paintingData = &paintingData;
-                params.stitchData = stitchData;
-                params.startY = startY;
-
-                unsigned jobHeight = (i < jobsWithExtra) ? stepY + 1 : stepY;
-                params.endY = params.startY + jobHeight;
-                startY += jobHeight;
-            }
-
-            parallelJobs.execute();
-            return;
-        }
-    }
 
-    // Fallback to single threaded mode if there is no room for a new thread or the paint area is too small.
-    applyPlatformGeneric(filterRegion, filterScale, pixelBuffer, paintingData, stitchData, 0, height);
+    // Give each chunk at least minimalRectDimension pixels, and at least 8 rows. Regions that fit in one
+    // chunk are painted on this thread.
+    size_t rowsPerChunk = std::max<size_t>(minimalRectDimension / std::max(filterRegion.width(), 1), 8);
+    parallelFor(0, filterRegion.height(), rowsPerChunk, [&](size_t startY, size_t endY) {
+        applyPlatformGeneric(filterRegion, filterScale, pixelBuffer, paintingData, stitchData, static_cast<int>(startY), static_cast<int>(endY));
+    });
 }
 
 bool FETurbulenceSoftwareApplier::apply(const Filter& filter, std::span<const Ref<FilterImage>>, FilterImage& result) const
@@ -92,16 +92,6 @@ private:
         int wrapY { 0 };
     };
 
-    struct ApplyParameters {
-        IntRect filterRegion;
-        FloatSize filterScale;
-        RefPtr<PixelBuffer> pixelBuffer;
-        PaintingData* paintingData;
-        StitchData stitchData;
-        int startY;
-        int endY;
-    };
-
     static inline float smoothCurve(float t) { return t * t * (3 - 2 * t); }
     static inline float linearInterpolation(float t, float a, float b) { return a + t * (b - a); }
 
@@ -113,7 +103,6 @@ private:
     static ColorComponents<uint8_t, 4> calculateTurbulenceValueForPoint(const PaintingData&, StitchData, const FloatPoint&);
 
     static void applyPlatformGeneric(const IntRect& filterRegion, const FloatSize& filterScale, PixelBuffer&, const PaintingData&, StitchData, int startY, int endY);
-    static void applyPlatformWorker(ApplyParameters*);
     static void applyPlatform(const IntRect& filterRegion, const FloatSize& filterScale, PixelBuffer&, PaintingData&, StitchData&);
 };
 
@@ -586,7 +586,7 @@ void ElementRuleCollector::collectMatchingRulesForList(const RuleSet::RuleDataVe
         if (matchRequest.ruleSet.hasContainerQueries() && !containerQueriesMatch(ruleData, matchRequest))
             continue;
 
-        std::optional<Vector<ScopingRootWithDistance>> scopingRoots;
+        std::optional<ScopingRoots> scopingRoots;
         if (matchRequest.ruleSet.hasScopeRules()) {
             auto [result, roots] = scopeRulesMatch(ruleData, matchRequest);
             if (!result)
@@ -645,7 +645,7 @@ bool ElementRuleCollector::containerQueriesMatch(const RuleData& ruleData, const
     return true;
 }
 
-std::pair<bool, std::optional<Vector<ElementRuleCollector::ScopingRootWithDistance>>> ElementRuleCollector::scopeRulesMatch(const RuleData& ruleData, const MatchRequest& matchRequest)
+auto ElementRuleCollector::scopeRulesMatch(const RuleData& ruleData, const MatchRequest& matchRequest) -> std::pair<bool, std::optional<ScopingRoots>>
 {
     auto scopeRules = matchRequest.ruleSet.scopeRulesFor(ruleData);
 
@@ -655,7 +655,7 @@ std::pair<bool, std::optional<Vector<ElementRuleCollector::ScopingRootWithDistan
     SelectorChecker checker(element().rootElement()->document());
     SelectorChecker::CheckingContext context(SelectorChecker::Mode::CollectingRulesIgnoringVirtualPseudoElements);
 
-    Vector<ScopingRootWithDistance> scopingRoots;
+    ScopingRoots scopingRoots;
     auto isWithinScope = [&](auto& rule) {
         auto previousScopingRoots = WTFMove(scopingRoots);
         // The last rule (=innermost @scope rule) determines the scoping roots
@@ -707,7 +707,7 @@ std::pair<bool, std::optional<Vector<ElementRuleCollector::ScopingRootWithDistan
                 return false;
             };
 
-            Vector<ScopingRootWithDistance> scopingRootsWithinScope;
+            ScopingRoots scopingRootsWithinScope;
             for (auto scopingRootWithDistance : scopingRoots) {
                 bool anyScopingLimitMatch = false;
                 for (const auto* selector = scopeEnd.first(); selector; selector = CSSSelectorList::next(selector)) {
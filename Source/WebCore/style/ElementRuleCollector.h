@@ -29,6 +29,7 @@
 #include "SelectorChecker.h"
 #include "StyleScopeOrdinal.h"
 #include <memory>
+#include <wtf/BumpArena.h>
 #include <wtf/RefPtr.h>
 #include <wtf/Vector.h>
 
@@ -105,7 +106,8 @@ private:
         RefPtr<const ContainerNode> scopingRoot;
         unsigned distance { std::numeric_limits<unsigned>::max() };
     };
-    std::pair<bool, std::optional<Vector<ScopingRootWithDistance>>> scopeRulesMatch(const RuleData&, const MatchRequest&);
+    using ScopingRoots = Vector<ScopingRootWithDistance, 0, CrashOnOverflow, 16, BumpArenaMalloc>;
+    std::pair<bool, std::optional<ScopingRoots>> scopeRulesMatch(const RuleData&, const MatchRequest&);
 
     void sortMatchedRules();
 
@@ -133,7 +135,9 @@ private:
     std::optional<PseudoElementRequest> m_pseudoElementRequest { };
     SelectorChecker::Mode m_mode { SelectorChecker::Mode::ResolvingStyle };
 
-    Vector<MatchedRule, 64> m_matchedRules;
+    // Collectors only live while one element is being matched. When that happens during style resolution,
+    // the scratch vectors come from the TreeResolver's arena.
+    Vector<MatchedRule, 64, CrashOnOverflow, 16, BumpArenaMalloc> m_matchedRules;
     size_t m_matchedRuleTransferIndex { 0 };
 
     // Output.
@@ -1180,7 +1180,10 @@ void TreeResolver::resolveComposedTree()
             if (element.hasCustomStyleResolveCallbacks())
                 element.willRecalcStyle(parent.changes);
 
-            auto [elementUpdate, elementDescendantsToResolve] = resolveElement(element, style, *resolutionType);
+            auto [elementUpdate, elementDescendantsToResolve] = [&] {
+                BumpArena::Scope scratchScope { m_scratchArena };
+                return resolveElement(element, style, *resolutionType);
+            }();
 
             if (element.hasCustomStyleResolveCallbacks())
                 element.didRecalcStyle(elementUpdate.changes);
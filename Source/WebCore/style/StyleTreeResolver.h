@@ -33,6 +33,7 @@
 #include "StyleUpdate.h"
 #include "Styleable.h"
 #include "TreeResolutionState.h"
+#include <wtf/BumpArena.h>
 #include <wtf/Function.h>
 #include <wtf/Ref.h>
 
@@ -224,6 +225,9 @@ private:
     HashSet<AtomString> m_changedAnchorNames;
     bool m_allAnchorNamesInvalid { false };
 
+    // Scratch memory for resolving a single element, like the rules it matched. It is reclaimed after each element.
+    BumpArena m_scratchArena;
+
     std::unique_ptr<Update> m_update;
 };
 
@@ -872,45 +872,40 @@ void Storage::dispatchReadOperation(std::unique_ptr<ReadOperation> readOperation
         m_readOperationTimeoutTimer.startOneShot(readTimeout);
     }
 
-    ioQueue().dispatch([this, protectedThis = Ref { *this }, identifier, recordPath = crossThreadCopy(WTFMove(recordPath)), blobPath = crossThreadCopy(WTFMove(blobPath))]() mutable {
-        readRecordFromData(identifier, MonotonicTime::now(), FileSystem::readEntireFile(recordPath));
-        readBlobIfNecessary(identifier, blobPath);
-    });
+    readRecordAndBlob(*this, identifier, crossThreadCopy(WTFMove(recordPath)), crossThreadCopy(WTFMove(blobPath)));
 }
 
-void Storage::readRecordFromData(Storage::ReadOperationIdentifier identifier, MonotonicTime recordIOStartTime, std::optional<Vector<uint8_t>>&& data)
+Task Storage::readRecordAndBlob(Ref<Storage> storage, Storage::ReadOperationIdentifier identifier, String recordPath, String blobPath)
 {
-    Record record;
-    if (data)
-        record = readRecord(WTFMove(*data));
+    co_await resumeOn(storage->ioQueue());
 
+    auto recordIOStartTime = MonotonicTime::now();
+    Record record;
+    if (auto data = FileSystem::readEntireFile(recordPath))
+        record = storage->readRecord(WTFMove(*data));
     auto recordIOEndTime = MonotonicTime::now();
-    RunLoop::protectedMain()->dispatch([this, protectedThis = Ref { *this }, identifier, recordIOStartTime, recordIOEndTime, record = crossThreadCopy(WTFMove(record))]() mutable {
-        auto* readOperation = m_activeReadOperations.get(identifier);
-        RELEASE_ASSERT(readOperation);
-
-        readOperation->finishReadRecord(WTFMove(record), recordIOStartTime, recordIOEndTime);
-        if (readOperation->canFinish())
-            finishReadOperation(identifier);
-    });
-}
+    record = crossThreadCopy(WTFMove(record));
+
+    BlobStorage::Blob blob;
+    MonotonicTime blobIOStartTime;
+    MonotonicTime blobIOEndTime;
+    if (!blobPath.isEmpty()) {
+        blobIOStartTime = MonotonicTime::now();
+        blob = storage->m_blobStorage.get(blobPath);
+        blobIOEndTime = MonotonicTime::now();
+    }
 
-void Storage::readBlobIfNecessary(Storage::ReadOperationIdentifier identifier, const String& blobPath)
-{
-    if (blobPath.isEmpty())
-        return;
+    // The operation can only finish once both the record and the blob are read, so deliver them together.
+    co_await resumeOn(RunLoop::main());
 
-    auto blobIOStartTime = MonotonicTime::now();
-    auto blob = m_blobStorage.get(blobPath);
-    auto blobIOEndTime = MonotonicTime::now();
-    RunLoop::protectedMain()->dispatch([this, protectedThis = Ref { *this }, identifier, blob = WTFMove(blob), blobIOStartTime, blobIOEndTime]() mutable {
-        auto* readOperation = m_activeReadOperations.get(identifier);
-        RELEASE_ASSERT(readOperation);
+    auto* readOperation = storage->m_activeReadOperations.get(identifier);
+    RELEASE_ASSERT(readOperation);
 
+    readOperation->finishReadRecord(WTFMove(record), recordIOStartTime, recordIOEndTime);
+    if (!blobPath.isEmpty())
         readOperation->finishReadBlob(WTFMove(blob), blobIOStartTime, blobIOEndTime);
-        if (readOperation->canFinish())
-            finishReadOperation(identifier);
-    });
+    ASSERT(readOperation->canFinish());
+    storage->finishReadOperation(identifier);
 }
 
 void Storage::finishReadOperation(Storage::ReadOperationIdentifier identifier)
@@ -31,6 +31,7 @@
 #include <WebCore/Timer.h>
 #include <wtf/BloomFilter.h>
 #include <wtf/CompletionHandler.h>
+#include <wtf/CoroutineUtilities.h>
 #include <wtf/Deque.h>
 #include <wtf/Function.h>
 #include <wtf/HashCountedSet.h>
@@ -172,8 +173,7 @@ private:
     std::optional<BlobStorage::Blob> storeBodyAsBlob(WriteOperationIdentifier, const Storage::Record&);
     Data encodeRecord(const Record&, std::optional<BlobStorage::Blob>);
     Record readRecord(const Data&);
-    void readRecordFromData(Storage::ReadOperationIdentifier, MonotonicTime, std::optional<Vector<uint8_t>>&&);
-    void readBlobIfNecessary(Storage::ReadOperationIdentifier, const String& blobPath);
+    static Task readRecordAndBlob(Ref<Storage>, Storage::ReadOperationIdentifier, String recordPath, String blobPath);
 
     void updateFileModificationTime(String&& path);
     void removeFromPendingWriteOperations(const Key&);
@@ -32,6 +32,7 @@
 
 #if BENABLE(LIBPAS)
 #include "bmalloc_heap_config.h"
+#include "pas_page_malloc.h"
 #include "pas_page_sharing_pool.h"
 #include "pas_probabilistic_guard_malloc_allocator.h"
 #include "pas_scavenger.h"
@@ -137,6 +138,16 @@ void scavengeThisThread()
 #endif
 }
 
+void donateThisThreadCache()
+{
+#if BENABLE(LIBPAS)
+    pas_thread_local_cache_donate();
+#endif
+#if !BUSE(LIBPAS)
+    scavengeThisThread();
+#endif
+}
+
 void scavenge()
 {
 #if BENABLE(LIBPAS)
@@ -223,6 +234,15 @@ void enableMiniMode(bool forceMiniMode)
 #endif
 }
 
+bool enableTransparentHugePages()
+{
+#if BENABLE(LIBPAS)
+    return pas_page_malloc_enable_huge_pages();
+#else
+    return false;
+#endif
+}
+
 void disableScavenger()
 {
 #if BENABLE(LIBPAS)
@@ -196,6 +196,10 @@ BEXPORT void freeLargeVirtual(void* object, size_t, HeapKind kind = HeapKind::Pr
 
 BEXPORT void scavengeThisThread();
 
+// Call this on a thread that is about to exit. It returns the memory cached by the thread to the heap right
+// away and, with libpas, hands the thread's cache over to the next thread that starts allocating.
+BEXPORT void donateThisThreadCache();
+
 BEXPORT void scavenge();
 
 BEXPORT bool isEnabled(HeapKind kind = HeapKind::Primary);
@@ -228,6 +232,10 @@ BEXPORT void setScavengerThreadQOSClass(qos_class_t overrideClass);
 
 BEXPORT void enableMiniMode(bool forceMiniMode = false);
 
+// Backs large libpas reservations with transparent huge pages where the OS supports it. Must be called
+// before the heap reserves memory for them to benefit. Returns false if unsupported.
+BEXPORT bool enableTransparentHugePages();
+
 // Used for debugging only.
 BEXPORT void disableScavenger();
 BEXPORT void forceEnablePGM(uint16_t guardMallocRate);
@@ -60,6 +60,10 @@
 #endif
 #define PAS_ENABLE_TESTING __PAS_ENABLE_TESTING
 
+/* Counting inline allocations costs a load and a store on the allocation fast path, so it is off by
+   default. Without it, telemetry still counts thread local cache refills (misses) but not hits. */
+#define PAS_ENABLE_INLINE_ALLOCATION_COUNTING 0
+
 #define PAS_ARM64 __PAS_ARM64
 #define PAS_ARM32 __PAS_ARM32
 
@@ -1131,6 +1131,53 @@ bool pas_large_sharing_pool_allocate_and_commit(
     return true;
 }
 
+/* Decommitting part of a transparent huge page makes the kernel split it, which costs us the TLB reach
+   of the live memory around it. So if the free node we are about to decommit only partially covers a
+   huge page, and the rest of that huge page is free too, we decommit the whole huge page at once. */
+static pas_range range_for_decommit(pas_large_sharing_node* node)
+{
+    size_t huge_page_size;
+    pas_range result;
+    uintptr_t huge_page_begin;
+    uintptr_t huge_page_end;
+    pas_large_sharing_node* other_node;
+
+    result = node->range;
+
+    huge_page_size = pas_page_malloc_huge_page_size;
+    if (!huge_page_size)
+        return result;
+
+    huge_page_begin = pas_round_down_to_power_of_2(result.begin, huge_page_size);
+    huge_page_end = pas_round_up_to_power_of_2(result.end, huge_page_size);
+
+    for (other_node = predecessor(node);
+         other_node && result.begin > huge_page_begin;
+         other_node = predecessor(other_node)) {
+        if (other_node->num_live_bytes
+            || other_node->synchronization_style != node->synchronization_style
+            || other_node->mmap_capability != node->mmap_capability)
+            break;
+        result.begin = PAS_MAX(other_node->range.begin, huge_page_begin);
+    }
+    if (result.begin != huge_page_begin)
+        result.begin = node->range.begin;
+
+    for (other_node = successor(node);
+         other_node && result.end < huge_page_end;
+         other_node = successor(other_node)) {
+        if (other_node->num_live_bytes
+            || other_node->synchronization_style != node->synchronization_style
+            || other_node->mmap_capability != node->mmap_capability)
+            break;
+        result.end = PAS_MIN(other_node->range.end, huge_page_end);
+    }
+    if (result.end != huge_page_end)
+        result.end = node->range.end;
+
+    return result;
+}
+
 pas_page_sharing_pool_take_result
 pas_large_sharing_pool_decommit_least_recently_used(
     pas_deferred_decommit_log* decommit_log)
@@ -1156,7 +1203,7 @@ pas_large_sharing_pool_decommit_least_recently_used(
                node->range.begin, node->range.end, (unsigned long long)node->use_epoch);
     }
     
-    if (try_splat(node->range, splat_decommit, 0, NULL, decommit_log, NULL,
+    if (try_splat(range_for_decommit(node), splat_decommit, 0, NULL, decommit_log, NULL,
                   node->synchronization_style, node->mmap_capability)) {
         if (verbose)
             pas_log("The splat worked.\n");
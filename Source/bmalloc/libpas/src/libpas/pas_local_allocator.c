@@ -64,6 +64,9 @@ void pas_local_allocator_construct(pas_local_allocator* allocator,
     allocator->page_ish = 0;
     allocator->current_offset = 0;
     allocator->end_offset = 0;
+#if PAS_ENABLE_INLINE_ALLOCATION_COUNTING
+    allocator->num_inline_allocations_since_refill = 0;
+#endif
     
     allocator->view = pas_segregated_size_directory_as_view(directory);
 
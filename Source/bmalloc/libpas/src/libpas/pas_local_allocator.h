@@ -74,6 +74,10 @@ struct pas_local_allocator {
                            page boundary. */
     unsigned current_offset; /* current_offset < end_offset means that we have bits to search. */
     unsigned end_offset;
+#if PAS_ENABLE_INLINE_ALLOCATION_COUNTING
+    unsigned num_inline_allocations_since_refill; /* Folded into the thread local cache's telemetry on
+                                                     refill. */
+#endif
     uint64_t current_word;
     pas_segregated_view view; /* points to a partial view if we're in partial mode or the size
                                  directory otherwise. This will point to a partial view in either
@@ -938,6 +938,9 @@ pas_local_allocator_refill_with_known_config(
     pas_segregated_shared_view* shared;
     pas_thread_local_cache* cache;
     bool did_get_view;
+#if PAS_ENABLE_INLINE_ALLOCATION_COUNTING
+    unsigned num_inline_allocations;
+#endif
 
     PAS_ASSERT(page_config.kind != pas_segregated_page_config_kind_null);
     PAS_ASSERT(page_config.base.is_enabled);
@@ -991,6 +994,11 @@ pas_local_allocator_refill_with_known_config(
                                                                                bits if that's what
                                                                                we were doing. */
     
+#if PAS_ENABLE_INLINE_ALLOCATION_COUNTING
+    num_inline_allocations = allocator->num_inline_allocations_since_refill;
+    allocator->num_inline_allocations_since_refill = 0;
+#endif
+
     pas_local_allocator_reset_impl(allocator, size_directory, page_config.kind);
 
 #if PAS_ENABLE_TESTING
@@ -1008,6 +1016,11 @@ pas_local_allocator_refill_with_known_config(
         
         if (cache) {
             cache_node = cache->node;
+
+#if PAS_ENABLE_INLINE_ALLOCATION_COUNTING
+            pas_telemetry_add_owned(&cache->telemetry.num_inline_allocations, num_inline_allocations);
+#endif
+            pas_telemetry_add_owned(&cache->telemetry.num_allocator_refills, 1);
             
             /* Doing this here has some special properties. For example, it doesn't prevent fast reuse
                of the page we just finished allocating out of. */
@@ -1789,6 +1802,9 @@ pas_local_allocator_try_allocate_inline_only(pas_local_allocator* allocator,
 
     result = pas_local_allocator_try_allocate_inline_cases(allocator, allocation_mode, config);
     if (result.did_succeed) {
+#if PAS_ENABLE_INLINE_ALLOCATION_COUNTING
+        allocator->num_inline_allocations_since_refill++;
+#endif
         pas_compiler_fence();
         allocator->scavenger_data.is_in_use = false;
         
@@ -1834,6 +1850,9 @@ pas_local_allocator_try_allocate(pas_local_allocator* allocator,
 
     result = pas_local_allocator_try_allocate_inline_cases(allocator, allocation_mode, config);
     if (result.did_succeed) {
+#if PAS_ENABLE_INLINE_ALLOCATION_COUNTING
+        allocator->num_inline_allocations_since_refill++;
+#endif
         pas_compiler_fence();
         allocator->scavenger_data.is_in_use = false;
         
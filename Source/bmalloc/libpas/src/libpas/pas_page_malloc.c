@@ -34,6 +34,7 @@
 #include "pas_config.h"
 #include "pas_internal_config.h"
 #include "pas_log.h"
+#include "pas_telemetry.h"
 #include "pas_utils.h"
 #include <stdio.h>
 #include <string.h>
@@ -54,6 +55,8 @@ size_t pas_page_malloc_cached_alignment_shift;
 bool pas_page_malloc_decommit_zero_fill = false;
 #endif /* PAS_OS(DARWIN) */
 
+size_t pas_page_malloc_huge_page_size = 0;
+
 #if PAS_OS(DARWIN)
 #define PAS_VM_TAG VM_MAKE_TAG(VM_MEMORY_TCMALLOC)
 #elif PAS_PLATFORM(PLAYSTATION) && defined(VM_MAKE_TAG)
@@ -93,6 +96,37 @@ PAS_NEVER_INLINE size_t pas_page_malloc_alignment_shift_slow(void)
     return result;
 }
 
+bool pas_page_malloc_enable_huge_pages(void)
+{
+#if PAS_OS(LINUX)
+    FILE* file;
+    unsigned long long huge_page_size;
+    int scanned_count;
+
+    if (pas_page_malloc_huge_page_size)
+        return true;
+
+    /* This file only exists if the kernel supports transparent huge pages. It tells us the size of a
+       PMD-mapped page, which is 2MB with 4KB pages. */
+    file = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+    if (!file)
+        return false;
+    scanned_count = fscanf(file, "%llu", &huge_page_size);
+    fclose(file);
+    errno = 0;
+
+    if (scanned_count != 1
+        || !pas_is_power_of_2(huge_page_size)
+        || huge_page_size <= pas_page_malloc_alignment())
+        return false;
+
+    pas_page_malloc_huge_page_size = (size_t)huge_page_size;
+    return true;
+#else
+    return false;
+#endif
+}
+
 static void*
 pas_page_malloc_try_map_pages(size_t size, bool may_contain_small_or_medium)
 {
@@ -118,6 +152,43 @@ pas_page_malloc_try_map_pages(size_t size, bool may_contain_small_or_medium)
 #endif
 }
 
+#if PAS_OS(LINUX)
+/* Maps size bytes starting at a huge page boundary, so the kernel can back the mapping with huge pages
+   from its start. The slop we map to find that boundary is unmapped right away, so callers see the
+   same padding as they would without huge pages. */
+static void*
+pas_page_malloc_try_map_huge_page_aligned_pages(size_t size, size_t huge_page_size,
+                                                bool may_contain_small_or_medium)
+{
+    size_t padded_size;
+    void* mmap_result;
+    uintptr_t mapped;
+    uintptr_t mapped_end;
+    uintptr_t aligned;
+    uintptr_t aligned_end;
+
+    if (__builtin_add_overflow(size, huge_page_size - pas_page_malloc_alignment(), &padded_size))
+        return NULL;
+
+    mmap_result = pas_page_malloc_try_map_pages(padded_size, may_contain_small_or_medium);
+    if (!mmap_result)
+        return NULL;
+
+    mapped = (uintptr_t)mmap_result;
+    mapped_end = mapped + padded_size;
+    aligned = pas_round_up_to_power_of_2(mapped, huge_page_size);
+    aligned_end = aligned + size;
+    PAS_ASSERT(aligned_end <= mapped_end);
+
+    if (aligned != mapped)
+        PAS_SYSCALL(munmap((void*)mapped, aligned - mapped));
+    if (aligned_end != mapped_end)
+        PAS_SYSCALL(munmap((void*)aligned_end, mapped_end - aligned_end));
+
+    return (void*)aligned;
+}
+#endif
+
 pas_aligned_allocation_result
 pas_page_malloc_try_allocate_without_deallocating_padding(
     size_t size, pas_alignment alignment, bool may_contain_small_or_medium)
@@ -133,6 +204,9 @@ pas_page_malloc_try_allocate_without_deallocating_padding(
     char* aligned_end;
     pas_aligned_allocation_result result;
     size_t page_allocation_alignment;
+#if PAS_OS(LINUX)
+    size_t huge_page_size;
+#endif
 
     if (verbose)
         pas_log("Allocating pages, size = %zu.\n", size);
@@ -155,10 +229,26 @@ pas_page_malloc_try_allocate_without_deallocating_padding(
             return result;
     }
 
-    mmap_result = pas_page_malloc_try_map_pages(mapped_size, may_contain_small_or_medium);
+#if PAS_OS(LINUX)
+    huge_page_size = pas_page_malloc_huge_page_size;
+    if (huge_page_size && size >= huge_page_size && page_allocation_alignment < huge_page_size) {
+        mmap_result = pas_page_malloc_try_map_huge_page_aligned_pages(
+            mapped_size, huge_page_size, may_contain_small_or_medium);
+    } else
+#endif
+        mmap_result = pas_page_malloc_try_map_pages(mapped_size, may_contain_small_or_medium);
     if (!mmap_result)
         return result;
 
+#if PAS_OS(LINUX)
+    if (huge_page_size && size >= huge_page_size) {
+        /* This is just advice, so don't assert. The kernel only uses huge pages for the parts of the
+           mapping that are aligned to them, which is why we mapped it at a huge page boundary. */
+        if (madvise(mmap_result, mapped_size, MADV_HUGEPAGE))
+            errno = 0;
+    }
+#endif
+
     uintptr_t pages_begin = (uintptr_t)mmap_result;
     mmap_result = (void*)pages_begin;
     
@@ -246,6 +336,9 @@ static void commit_impl(void* ptr, size_t size, bool do_mprotect, pas_mmap_capab
     if (end_as_int == base_as_int)
         return;
 
+    pas_telemetry_add(&pas_telemetry_global_counters.num_commits, 1);
+    pas_telemetry_add(&pas_telemetry_global_counters.committed_bytes, size);
+
     if (PAS_MPROTECT_DECOMMITTED && do_mprotect && mmap_capability) {
 #if PAS_OS(WINDOWS)
         PAS_ASSERT(VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE));
@@ -309,6 +402,9 @@ static void decommit_impl(void* ptr, size_t size,
         base_as_int == pas_round_up_to_power_of_2(base_as_int, pas_page_malloc_alignment()));
     PAS_ASSERT(
         end_as_int == pas_round_down_to_power_of_2(end_as_int, pas_page_malloc_alignment()));
+
+    pas_telemetry_add(&pas_telemetry_global_counters.num_decommits, 1);
+    pas_telemetry_add(&pas_telemetry_global_counters.decommitted_bytes, size);
     
 #if PAS_OS(DARWIN)
     if (pas_page_malloc_decommit_zero_fill && mmap_capability)
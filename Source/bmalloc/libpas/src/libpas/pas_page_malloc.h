@@ -40,6 +40,11 @@ PAS_API extern size_t pas_page_malloc_cached_alignment_shift;
 PAS_API extern bool pas_page_malloc_decommit_zero_fill;
 #endif /* PAS_OS(DARWIN) */
 
+/* Zero unless huge pages were enabled with pas_page_malloc_enable_huge_pages(). When it is nonzero,
+   reservations of at least this size are aligned to it and advised to be backed by transparent huge
+   pages, and the large sharing pool tries to decommit whole huge pages. */
+PAS_API extern size_t pas_page_malloc_huge_page_size;
+
 PAS_API PAS_NEVER_INLINE size_t pas_page_malloc_alignment_slow(void);
 
 static inline size_t pas_page_malloc_alignment(void)
@@ -62,6 +67,10 @@ PAS_API pas_aligned_allocation_result
 pas_page_malloc_try_allocate_without_deallocating_padding(
     size_t size, pas_alignment alignment, bool may_contain_small_or_medium);
 
+/* Opts into transparent huge pages on Linux. This only affects reservations made after the call, so
+   it should be called early. Returns false if huge pages are not available. */
+PAS_API bool pas_page_malloc_enable_huge_pages(void);
+
 PAS_API void pas_page_malloc_deallocate(void* base, size_t size);
 
 PAS_API void pas_page_malloc_zero_fill(void* base, size_t size);
@@ -41,7 +41,9 @@
 #include "pas_large_expendable_memory.h"
 #include "pas_lock.h"
 #include "pas_page_sharing_pool.h"
+#include "pas_scavenger_policy.h"
 #include "pas_status_reporter.h"
+#include "pas_telemetry.h"
 #include "pas_thread_local_cache.h"
 #include "pas_utility_heap.h"
 #include "pas_utils.h"
@@ -181,6 +183,7 @@ static void* scavenger_thread_main(void* arg)
 {
     pas_scavenger_data* data;
     pas_scavenger_activity_callback did_start_callback;
+    pas_scavenger_policy_state policy_state;
 #if PAS_OS(DARWIN)
     qos_class_t configured_qos_class;
 #endif
@@ -213,6 +216,8 @@ static void* scavenger_thread_main(void* arg)
 
     PAS_PROFILE(SCAVENGER_THREAD_MAIN, data);
 
+    policy_state = PAS_SCAVENGER_POLICY_STATE_INITIALIZER;
+
     for (;;) {
         pas_page_sharing_pool_scavenge_result scavenge_result;
         bool should_shut_down;
@@ -280,7 +285,10 @@ static void* scavenger_thread_main(void* arg)
            This code is engineered to kind of limp along when the epoch is a counter, but it doesn't
            actually achieve its full purpose unless the epoch really is time. */
         epoch = pas_get_epoch();
-        delta = pas_scavenger_max_epoch_delta;
+        delta = pas_scavenger_policy_select_max_epoch_delta(
+            &policy_state, pas_scavenger_max_epoch_delta, get_time_in_milliseconds(),
+            pas_atomic_load_uint64_relaxed(&pas_telemetry_global_counters.committed_bytes)
+            - pas_atomic_load_uint64_relaxed(&pas_telemetry_global_counters.decommitted_bytes));
 
         did_overflow = __builtin_sub_overflow(epoch, (uint64_t)delta, &max_epoch);
         if (did_overflow)
@@ -289,8 +297,14 @@ static void* scavenger_thread_main(void* arg)
         if (verbose)
             pas_log("epoch = %llu, delta = %llu, max_epoch = %llu\n", (unsigned long long)epoch, (unsigned long long)delta, (unsigned long long)max_epoch);
 
+        /* Do this first so that the pages of the freed caches can be decommitted right away. */
+        should_go_again |= pas_thread_local_cache_trim_parked(max_epoch, pas_lock_is_not_held);
+
         scavenge_result = pas_physical_page_sharing_pool_scavenge(max_epoch);
 
+        pas_telemetry_add(&pas_telemetry_global_counters.num_scavenger_ticks, 1);
+        pas_telemetry_add(&pas_telemetry_global_counters.scavenger_decommitted_bytes, scavenge_result.total_bytes);
+
         switch (scavenge_result.take_result) {
         case pas_page_sharing_pool_take_none_available:
             break;
@@ -584,6 +598,8 @@ void pas_scavenger_clear_all_caches(void)
     pas_thread_local_cache_for_all(pas_allocator_scavenge_force_stop_action,
                                    pas_deallocator_scavenge_flush_log_action,
                                    pas_thread_local_cache_decommit_if_possible_action);
+
+    pas_thread_local_cache_trim_parked(PAS_EPOCH_MAX, pas_lock_is_not_held);
 }
 
 void pas_scavenger_decommit_expendable_memory(void)
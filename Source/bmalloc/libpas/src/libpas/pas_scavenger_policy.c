@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pas_config.h"
+
+#if LIBPAS_ENABLED
+
+#include "pas_scavenger_policy.h"
+
+#include "pas_log.h"
+
+static const bool verbose = false;
+
+pas_scavenger_memory_limit_callback pas_scavenger_policy_memory_limit_callback = NULL;
+bool pas_scavenger_policy_is_enabled = true;
+double pas_scavenger_policy_pressure_threshold = .75;
+double pas_scavenger_policy_critical_threshold = .95;
+double pas_scavenger_policy_max_lazy_factor = 4.;
+double pas_scavenger_policy_high_commit_rate_in_bytes_per_millisecond = 10. * 1024. * 1024. / 1000.;
+double pas_scavenger_policy_sample_period_in_milliseconds = 100.;
+
+uint64_t pas_scavenger_policy_compute_max_epoch_delta(
+    uint64_t base_max_epoch_delta,
+    pas_scavenger_memory_limit_status status,
+    double commit_rate_in_bytes_per_millisecond)
+{
+    double usage;
+    double delta;
+    double headroom_in_bytes;
+
+    if (!status.limit_bytes)
+        return base_max_epoch_delta;
+
+    if (status.current_bytes >= status.limit_bytes)
+        return 0;
+
+    usage = (double)status.current_bytes / (double)status.limit_bytes;
+    if (usage >= pas_scavenger_policy_critical_threshold)
+        return 0;
+
+    delta = (double)base_max_epoch_delta;
+
+    if (usage >= pas_scavenger_policy_pressure_threshold) {
+        /* Shrink linearly from the base delay at the pressure threshold to nothing at the critical one. */
+        delta *= (pas_scavenger_policy_critical_threshold - usage)
+            / (pas_scavenger_policy_critical_threshold - pas_scavenger_policy_pressure_threshold);
+    } else if (commit_rate_in_bytes_per_millisecond > 0.) {
+        double lazy_factor;
+
+        /* Plenty of headroom. If we are committing quickly, the pages we would decommit are likely to be
+           needed again soon, so decommitting them would just cause a page fault storm. */
+        lazy_factor = 1. + (pas_scavenger_policy_max_lazy_factor - 1.) * PAS_MIN(
+            1., commit_rate_in_bytes_per_millisecond / pas_scavenger_policy_high_commit_rate_in_bytes_per_millisecond);
+        delta *= lazy_factor;
+    }
+
+    headroom_in_bytes = (double)(status.limit_bytes - status.current_bytes);
+    if (commit_rate_in_bytes_per_millisecond > 0.) {
+        double time_to_limit_in_nanoseconds;
+
+        /* Whatever the usage is, we should not wait longer than it would take us to hit the limit at the
+           current commit rate. Leave half of that time for the decommit itself to help. The epoch is time
+           in nanoseconds. */
+        time_to_limit_in_nanoseconds = headroom_in_bytes / commit_rate_in_bytes_per_millisecond * 1000. * 1000.;
+        delta = PAS_MIN(delta, time_to_limit_in_nanoseconds / 2.);
+    }
+
+    if (delta >= (double)UINT64_MAX)
+        return UINT64_MAX;
+    return (uint64_t)delta;
+}
+
+uint64_t pas_scavenger_policy_select_max_epoch_delta(
+    pas_scavenger_policy_state* state,
+    uint64_t base_max_epoch_delta,
+    double time_in_milliseconds,
+    uint64_t committed_bytes)
+{
+    pas_scavenger_memory_limit_callback callback;
+    pas_scavenger_memory_limit_status status;
+    double elapsed_in_milliseconds;
+
+    callback = pas_scavenger_policy_memory_limit_callback;
+    if (!pas_scavenger_policy_is_enabled || !callback)
+        return base_max_epoch_delta;
+
+    if (!state->has_sample) {
+        state->has_sample = true;
+        state->last_sample_time_in_milliseconds = time_in_milliseconds;
+        state->last_committed_bytes = committed_bytes;
+        state->commit_rate_in_bytes_per_millisecond = 0.;
+        state->max_epoch_delta = base_max_epoch_delta;
+    } else {
+        elapsed_in_milliseconds = time_in_milliseconds - state->last_sample_time_in_milliseconds;
+        if (elapsed_in_milliseconds < pas_scavenger_policy_sample_period_in_milliseconds)
+            return state->max_epoch_delta;
+
+        /* Smooth the rate so that one burst of commits does not flip the policy back and forth. */
+        state->commit_rate_in_bytes_per_millisecond =
+            (state->commit_rate_in_bytes_per_millisecond
+             + (double)(int64_t)(committed_bytes - state->last_committed_bytes) / elapsed_in_milliseconds) / 2.;
+        state->last_sample_time_in_milliseconds = time_in_milliseconds;
+        state->last_committed_bytes = committed_bytes;
+    }
+
+    status.current_bytes = 0;
+    status.limit_bytes = 0;
+    if (!callback(&status))
+        status.limit_bytes = 0;
+
+    state->max_epoch_delta = pas_scavenger_policy_compute_max_epoch_delta(
+        base_max_epoch_delta, status, state->commit_rate_in_bytes_per_millisecond);
+
+    if (verbose) {
+        pas_log("scavenger policy: current = %zu, limit = %zu, commit rate = %.0lf bytes/ms, delta = %llu\n",
+                status.current_bytes, status.limit_bytes, state->commit_rate_in_bytes_per_millisecond,
+                (unsigned long long)state->max_epoch_delta);
+    }
+
+    return state->max_epoch_delta;
+}
+
+#endif /* LIBPAS_ENABLED */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PAS_SCAVENGER_POLICY_H
+#define PAS_SCAVENGER_POLICY_H
+
+#include "pas_utils.h"
+
+PAS_BEGIN_EXTERN_C;
+
+struct pas_scavenger_memory_limit_status;
+struct pas_scavenger_policy_state;
+typedef struct pas_scavenger_memory_limit_status pas_scavenger_memory_limit_status;
+typedef struct pas_scavenger_policy_state pas_scavenger_policy_state;
+
+/* The scavenger policy adjusts how long free pages have to sit idle before the scavenger decommits them
+   (pas_scavenger_max_epoch_delta). It uses two inputs:
+
+   - A memory limit reported by the embedder, for example a cgroup limit. As usage approaches the limit,
+     the delay shrinks down to zero. When there is a lot of headroom and the process is committing memory
+     quickly, the delay grows, since pages we decommit now are likely to be faulted right back in.
+   - The rate at which we commit memory, which is how fast we would reach the limit.
+
+   Without a memory limit, the policy leaves pas_scavenger_max_epoch_delta alone. */
+
+struct pas_scavenger_memory_limit_status {
+    size_t current_bytes;
+    size_t limit_bytes;
+};
+
+/* Returns false if there is no limit. Called from the scavenger thread with no locks held. */
+typedef bool (*pas_scavenger_memory_limit_callback)(pas_scavenger_memory_limit_status* status);
+
+/* It's legal to set this anytime. */
+PAS_API extern pas_scavenger_memory_limit_callback pas_scavenger_policy_memory_limit_callback;
+
+PAS_API extern bool pas_scavenger_policy_is_enabled;
+
+/* Usage of the limit at which we start decommitting more eagerly, and at which we decommit everything
+   we can as soon as it is free. */
+PAS_API extern double pas_scavenger_policy_pressure_threshold;
+PAS_API extern double pas_scavenger_policy_critical_threshold;
+
+/* With plenty of headroom, the delay is scaled up by up to this factor as the commit rate approaches
+   pas_scavenger_policy_high_commit_rate_in_bytes_per_millisecond. */
+PAS_API extern double pas_scavenger_policy_max_lazy_factor;
+PAS_API extern double pas_scavenger_policy_high_commit_rate_in_bytes_per_millisecond;
+
+/* How often to ask for the memory limit. Reading cgroup files on every scavenger tick would be wasteful
+   when the scavenger period is short. */
+PAS_API extern double pas_scavenger_policy_sample_period_in_milliseconds;
+
+struct pas_scavenger_policy_state {
+    bool has_sample;
+    double last_sample_time_in_milliseconds;
+    uint64_t last_committed_bytes;
+    double commit_rate_in_bytes_per_millisecond;
+    uint64_t max_epoch_delta;
+};
+
+#define PAS_SCAVENGER_POLICY_STATE_INITIALIZER ((pas_scavenger_policy_state){ \
+        .has_sample = false, \
+        .last_sample_time_in_milliseconds = 0., \
+        .last_committed_bytes = 0, \
+        .commit_rate_in_bytes_per_millisecond = 0., \
+        .max_epoch_delta = 0 \
+    })
+
+PAS_API uint64_t pas_scavenger_policy_compute_max_epoch_delta(
+    uint64_t base_max_epoch_delta,
+    pas_scavenger_memory_limit_status status,
+    double commit_rate_in_bytes_per_millisecond);
+
+/* Called by the scavenger on every tick. committed_bytes is the net number of bytes committed so far, that
+   is cumulative commits minus cumulative decommits, which the policy turns into a commit rate. The rate is
+   negative while the heap shrinks. Modular arithmetic makes this work even if the subtraction wraps. */
+PAS_API uint64_t pas_scavenger_policy_select_max_epoch_delta(
+    pas_scavenger_policy_state* state,
+    uint64_t base_max_epoch_delta,
+    double time_in_milliseconds,
+    uint64_t committed_bytes);
+
+PAS_END_EXTERN_C;
+
+#endif /* PAS_SCAVENGER_POLICY_H */
+
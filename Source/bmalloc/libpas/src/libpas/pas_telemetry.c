@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pas_config.h"
+
+#if LIBPAS_ENABLED
+
+#include "pas_telemetry.h"
+
+#include "pas_all_heaps.h"
+#include "pas_heap.h"
+#include "pas_heap_lock.h"
+#include "pas_segregated_directory.h"
+#include "pas_segregated_heap.h"
+#include "pas_segregated_size_directory.h"
+#include "pas_stream.h"
+#include "pas_thread_local_cache.h"
+#include "pas_thread_local_cache_node.h"
+
+pas_telemetry_counters pas_telemetry_global_counters;
+
+/* Counters of thread local caches that have been destroyed. Protected by the heap lock. */
+static pas_telemetry_thread_local_cache_counters retired_thread_local_cache_counters;
+
+/* The counters may be bumped by their owning thread while we read them. */
+static void add_thread_local_cache_counters(pas_telemetry_thread_local_cache_counters* result,
+                                            pas_telemetry_thread_local_cache_counters* counters)
+{
+    result->num_inline_allocations += pas_atomic_load_uint64_relaxed(&counters->num_inline_allocations);
+    result->num_allocator_refills += pas_atomic_load_uint64_relaxed(&counters->num_allocator_refills);
+    result->num_deallocation_log_flushes +=
+        pas_atomic_load_uint64_relaxed(&counters->num_deallocation_log_flushes);
+    result->num_logged_deallocations += pas_atomic_load_uint64_relaxed(&counters->num_logged_deallocations);
+}
+
+void pas_telemetry_did_destroy_thread_local_cache(pas_telemetry_thread_local_cache_counters* counters)
+{
+    pas_heap_lock_assert_held();
+    add_thread_local_cache_counters(&retired_thread_local_cache_counters, counters);
+}
+
+void pas_telemetry_get_counters(pas_telemetry_counters* result)
+{
+    pas_telemetry_thread_local_cache_counters cache_counters;
+    pas_thread_local_cache_node* node;
+    uint64_t num_thread_local_caches;
+
+    pas_zero_memory(result, sizeof(pas_telemetry_counters));
+    result->num_commits = pas_atomic_load_uint64_relaxed(&pas_telemetry_global_counters.num_commits);
+    result->committed_bytes = pas_atomic_load_uint64_relaxed(&pas_telemetry_global_counters.committed_bytes);
+    result->num_decommits = pas_atomic_load_uint64_relaxed(&pas_telemetry_global_counters.num_decommits);
+    result->decommitted_bytes = pas_atomic_load_uint64_relaxed(&pas_telemetry_global_counters.decommitted_bytes);
+    result->num_scavenger_ticks = pas_atomic_load_uint64_relaxed(&pas_telemetry_global_counters.num_scavenger_ticks);
+    result->scavenger_decommitted_bytes =
+        pas_atomic_load_uint64_relaxed(&pas_telemetry_global_counters.scavenger_decommitted_bytes);
+
+    num_thread_local_caches = 0;
+
+    /* Holding the heap lock keeps caches from being destroyed or reallocated under us. The owning threads
+       keep bumping their counters while we read them. */
+    pas_heap_lock_lock();
+    cache_counters = retired_thread_local_cache_counters;
+    for (node = pas_thread_local_cache_node_first; node; node = node->next) {
+        pas_thread_local_cache* cache;
+
+        cache = node->cache;
+        if (!cache)
+            continue;
+
+        add_thread_local_cache_counters(&cache_counters, &cache->telemetry);
+        num_thread_local_caches++;
+    }
+    pas_heap_lock_unlock();
+
+    result->num_inline_allocations = cache_counters.num_inline_allocations;
+    result->num_allocator_refills = cache_counters.num_allocator_refills;
+    result->inline_allocations_are_counted = PAS_ENABLE_INLINE_ALLOCATION_COUNTING;
+    result->num_deallocation_log_flushes = cache_counters.num_deallocation_log_flushes;
+    result->num_logged_deallocations = cache_counters.num_logged_deallocations;
+    result->num_thread_local_caches = num_thread_local_caches;
+}
+
+typedef struct {
+    pas_telemetry_for_each_heap_callback callback;
+    void* arg;
+} for_each_heap_data;
+
+static bool for_each_heap_callback(pas_heap* heap, void* arg)
+{
+    for_each_heap_data* data;
+
+    data = (for_each_heap_data*)arg;
+
+    return data->callback(
+        heap, pas_telemetry_heap_stats_create(pas_heap_compute_summary(heap, pas_lock_is_held)), data->arg);
+}
+
+bool pas_telemetry_for_each_heap(pas_telemetry_for_each_heap_callback callback, void* arg)
+{
+    for_each_heap_data data;
+    bool result;
+
+    data.callback = callback;
+    data.arg = arg;
+
+    pas_heap_lock_lock();
+    result = pas_all_heaps_for_each_heap(for_each_heap_callback, &data);
+    pas_heap_lock_unlock();
+
+    return result;
+}
+
+typedef struct {
+    pas_telemetry_for_each_size_class_callback callback;
+    pas_heap* heap;
+    void* arg;
+} for_each_size_class_data;
+
+static bool for_each_size_directory_callback(pas_segregated_heap* segregated_heap,
+                                             pas_segregated_size_directory* directory,
+                                             void* arg)
+{
+    for_each_size_class_data* data;
+
+    PAS_UNUSED_PARAM(segregated_heap);
+
+    data = (for_each_size_class_data*)arg;
+
+    return data->callback(
+        data->heap, directory->object_size,
+        pas_telemetry_heap_stats_create(pas_segregated_directory_compute_summary(&directory->base)),
+        data->arg);
+}
+
+static bool for_each_size_class_heap_callback(pas_heap* heap, void* arg)
+{
+    for_each_size_class_data* data;
+
+    data = (for_each_size_class_data*)arg;
+    data->heap = heap;
+
+    return pas_segregated_heap_for_each_size_directory(
+        &heap->segregated_heap, for_each_size_directory_callback, data);
+}
+
+bool pas_telemetry_for_each_size_class(pas_telemetry_for_each_size_class_callback callback, void* arg)
+{
+    for_each_size_class_data data;
+    bool result;
+
+    data.callback = callback;
+    data.heap = NULL;
+    data.arg = arg;
+
+    pas_heap_lock_lock();
+    result = pas_all_heaps_for_each_heap(for_each_size_class_heap_callback, &data);
+    pas_heap_lock_unlock();
+
+    return result;
+}
+
+static void dump_heap_stats(pas_stream* stream, pas_telemetry_heap_stats stats)
+{
+    pas_stream_printf(
+        stream, "committed = %zu, allocated = %zu, dirty free = %zu, decommitted = %zu, fragmentation = %zu",
+        stats.committed_bytes, stats.allocated_bytes, stats.dirty_free_bytes, stats.decommitted_bytes,
+        stats.fragmentation_bytes);
+}
+
+static bool dump_heap_callback(pas_heap* heap, pas_telemetry_heap_stats stats, void* arg)
+{
+    pas_stream* stream;
+
+    stream = (pas_stream*)arg;
+
+    if (!stats.committed_bytes && !stats.decommitted_bytes)
+        return true;
+
+    pas_stream_printf(stream, "        Heap %p: ", heap);
+    dump_heap_stats(stream, stats);
+    pas_stream_printf(stream, "\n");
+    return true;
+}
+
+static bool dump_size_class_callback(pas_heap* heap, unsigned object_size, pas_telemetry_heap_stats stats,
+                                     void* arg)
+{
+    pas_stream* stream;
+
+    stream = (pas_stream*)arg;
+
+    if (!stats.committed_bytes)
+        return true;
+
+    pas_stream_printf(stream, "        Heap %p, Size %u: ", heap, object_size);
+    dump_heap_stats(stream, stats);
+    pas_stream_printf(stream, "\n");
+    return true;
+}
+
+void pas_telemetry_dump(pas_stream* stream)
+{
+    pas_telemetry_counters counters;
+    uint64_t num_allocations;
+
+    pas_telemetry_get_counters(&counters);
+
+    pas_stream_printf(stream, "libpas telemetry:\n");
+    pas_stream_printf(stream, "    Commits: %llu (%llu bytes), Decommits: %llu (%llu bytes)\n",
+                      (unsigned long long)counters.num_commits,
+                      (unsigned long long)counters.committed_bytes,
+                      (unsigned long long)counters.num_decommits,
+                      (unsigned long long)counters.decommitted_bytes);
+    pas_stream_printf(stream, "    Scavenger: %llu ticks, %llu bytes decommitted\n",
+                      (unsigned long long)counters.num_scavenger_ticks,
+                      (unsigned long long)counters.scavenger_decommitted_bytes);
+
+    pas_stream_printf(stream, "    Thread Local Caches: %llu live, ",
+                      (unsigned long long)counters.num_thread_local_caches);
+    if (counters.inline_allocations_are_counted)
+        pas_stream_printf(stream, "%llu hits, ", (unsigned long long)counters.num_inline_allocations);
+    else
+        pas_stream_printf(stream, "hits unavailable, ");
+    pas_stream_printf(stream, "%llu refills", (unsigned long long)counters.num_allocator_refills);
+    num_allocations = counters.num_inline_allocations + counters.num_allocator_refills;
+    if (counters.inline_allocations_are_counted && num_allocations) {
+        pas_stream_printf(stream, " (hit rate %.2lf%%)",
+                          100. * (double)counters.num_inline_allocations / (double)num_allocations);
+    }
+    pas_stream_printf(stream, ", %llu deallocation log flushes of %llu objects\n",
+                      (unsigned long long)counters.num_deallocation_log_flushes,
+                      (unsigned long long)counters.num_logged_deallocations);
+
+    pas_stream_printf(stream, "    Heaps:\n");
+    pas_telemetry_for_each_heap(dump_heap_callback, stream);
+    pas_stream_printf(stream, "    Size Classes:\n");
+    pas_telemetry_for_each_size_class(dump_size_class_callback, stream);
+}
+
+#endif /* LIBPAS_ENABLED */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PAS_TELEMETRY_H
+#define PAS_TELEMETRY_H
+
+#include "pas_heap_summary.h"
+#include "pas_utils.h"
+
+PAS_BEGIN_EXTERN_C;
+
+#ifndef pas_heap
+#define pas_heap __pas_heap
+#endif
+
+struct pas_heap;
+struct pas_stream;
+struct pas_telemetry_counters;
+struct pas_telemetry_heap_stats;
+struct pas_telemetry_thread_local_cache_counters;
+typedef struct pas_heap pas_heap;
+typedef struct pas_stream pas_stream;
+typedef struct pas_telemetry_counters pas_telemetry_counters;
+typedef struct pas_telemetry_heap_stats pas_telemetry_heap_stats;
+typedef struct pas_telemetry_thread_local_cache_counters pas_telemetry_thread_local_cache_counters;
+
+/* Telemetry is the cheap sibling of pas_status_reporter: it is meant to be sampled continuously in
+   production. The counters are bumped where the event already happens (commits, decommits, scavenger
+   ticks, local allocator refills, deallocation log flushes), so reading them never walks the heap.
+   All counters are cumulative since process start; clients compute rates by sampling twice.
+
+   The per-heap and per-size-class stats do walk the heap's directories, but only to compute
+   summaries, which is much cheaper than the text dumps of the status reporter. */
+
+struct pas_telemetry_counters {
+    uint64_t num_commits;
+    uint64_t committed_bytes;
+    uint64_t num_decommits;
+    uint64_t decommitted_bytes;
+
+    uint64_t num_scavenger_ticks;
+    uint64_t scavenger_decommitted_bytes;
+
+    /* An inline allocation is a thread local cache hit. A refill is a miss. Hits are only counted
+       if PAS_ENABLE_INLINE_ALLOCATION_COUNTING; otherwise inline_allocations_are_counted is false and
+       num_inline_allocations is meaningless, so clients must report hits as unavailable. */
+    uint64_t num_inline_allocations;
+    uint64_t num_allocator_refills;
+    bool inline_allocations_are_counted;
+
+    uint64_t num_deallocation_log_flushes;
+    uint64_t num_logged_deallocations;
+
+    uint64_t num_thread_local_caches;
+};
+
+/* These live in each pas_thread_local_cache and are only ever written by the thread that owns it, using
+   pas_telemetry_add_owned. pas_telemetry_get_counters reads them from other threads. */
+struct pas_telemetry_thread_local_cache_counters {
+    uint64_t num_inline_allocations;
+    uint64_t num_allocator_refills;
+    uint64_t num_deallocation_log_flushes;
+    uint64_t num_logged_deallocations;
+};
+
+struct pas_telemetry_heap_stats {
+    size_t committed_bytes;
+    size_t allocated_bytes;
+    size_t dirty_free_bytes; /* Free but still committed. The scavenger may decommit some of it. */
+    size_t decommitted_bytes;
+    size_t fragmentation_bytes; /* Committed free and meta bytes that are ineligible for decommit. */
+};
+
+/* Only the process-wide events go here; thread local cache events are counted in the cache. */
+PAS_API extern pas_telemetry_counters pas_telemetry_global_counters;
+
+static inline void pas_telemetry_add(uint64_t* counter, uint64_t amount)
+{
+    for (;;) {
+        uint64_t old_value;
+        old_value = *(volatile uint64_t*)counter;
+        if (pas_compare_and_swap_uint64_weak(counter, old_value, old_value + amount))
+            return;
+    }
+}
+
+/* For counters that only one thread writes but any thread may read. A relaxed load and store is enough
+   since there is no other writer, and it keeps the readers from seeing torn or invented values. */
+static inline void pas_telemetry_add_owned(uint64_t* counter, uint64_t amount)
+{
+    pas_atomic_store_uint64_relaxed(counter, pas_atomic_load_uint64_relaxed(counter) + amount);
+}
+
+static inline pas_telemetry_heap_stats pas_telemetry_heap_stats_create(pas_heap_summary summary)
+{
+    pas_telemetry_heap_stats result;
+    result.committed_bytes = summary.committed;
+    result.allocated_bytes = summary.allocated;
+    result.dirty_free_bytes = summary.free - summary.free_decommitted;
+    result.decommitted_bytes = summary.decommitted;
+    result.fragmentation_bytes = pas_heap_summary_fragmentation(summary);
+    return result;
+}
+
+/* Have to hold the heap lock to call this. */
+PAS_API void pas_telemetry_did_destroy_thread_local_cache(
+    pas_telemetry_thread_local_cache_counters* counters);
+
+/* Takes the heap lock to fold in the counters of live thread local caches. */
+PAS_API void pas_telemetry_get_counters(pas_telemetry_counters* result);
+
+typedef bool (*pas_telemetry_for_each_heap_callback)(
+    pas_heap* heap, pas_telemetry_heap_stats stats, void* arg);
+
+typedef bool (*pas_telemetry_for_each_size_class_callback)(
+    pas_heap* heap, unsigned object_size, pas_telemetry_heap_stats stats, void* arg);
+
+/* These take the heap lock. They do not report the utility heap. */
+PAS_API bool pas_telemetry_for_each_heap(pas_telemetry_for_each_heap_callback callback, void* arg);
+PAS_API bool pas_telemetry_for_each_size_class(pas_telemetry_for_each_size_class_callback callback,
+                                               void* arg);
+
+PAS_API void pas_telemetry_dump(pas_stream* stream);
+
+PAS_END_EXTERN_C;
+
+#endif /* PAS_TELEMETRY_H */
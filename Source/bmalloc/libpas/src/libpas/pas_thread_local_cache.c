@@ -33,6 +33,7 @@
 #include "pas_bitvector.h"
 #include "pas_committed_pages_vector.h"
 #include "pas_debug_heap.h"
+#include "pas_epoch.h"
 #include "pas_heap_lock.h"
 #include "pas_large_utility_free_heap.h"
 #include "pas_log.h"
@@ -65,6 +66,14 @@ __thread void* pas_thread_local_cache_pointer = NULL;
 
 pas_fast_tls pas_thread_local_cache_fast_tls = PAS_FAST_TLS_INITIALIZER;
 
+unsigned pas_thread_local_cache_max_num_parked = 4;
+unsigned pas_thread_local_cache_num_parked = 0;
+unsigned pas_thread_local_cache_template_allocator_index_capacity = 0;
+
+/* Ordered by the time at which they were parked, so the last one is the warmest. */
+static pas_thread_local_cache* parked_caches[PAS_THREAD_LOCAL_CACHE_MAX_NUM_PARKED];
+static uint64_t parked_epochs[PAS_THREAD_LOCAL_CACHE_MAX_NUM_PARKED];
+
 size_t pas_thread_local_cache_size_for_allocator_index_capacity(unsigned allocator_index_capacity)
 {
     size_t result;
@@ -121,7 +130,84 @@ static void deallocate(pas_thread_local_cache* thread_local_cache)
     pas_large_utility_free_heap_deallocate(begin, size);
 }
 
-static void destroy(pas_thread_local_cache* thread_local_cache, pas_lock_hold_mode heap_lock_hold_mode)
+static bool park(pas_thread_local_cache* thread_local_cache)
+{
+    static const bool verbose = false;
+
+    unsigned index;
+
+    pas_heap_lock_assert_held();
+    PAS_ASSERT(pas_thread_local_cache_max_num_parked <= PAS_THREAD_LOCAL_CACHE_MAX_NUM_PARKED);
+
+    if (pas_thread_local_cache_num_parked >= pas_thread_local_cache_max_num_parked)
+        return false;
+
+    if (verbose)
+        pas_log("[%d] Parking TLC %p\n", getpid(), thread_local_cache);
+
+    /* Shrinking has flushed the log and stopped the allocators, so all that is left are the pages. */
+    PAS_ASSERT(!thread_local_cache->deallocation_log_index);
+    thread_local_cache->node = NULL;
+
+    index = pas_thread_local_cache_num_parked++;
+    parked_caches[index] = thread_local_cache;
+    parked_epochs[index] = pas_get_epoch();
+
+    pas_scavenger_did_create_eligible();
+    return true;
+}
+
+static pas_thread_local_cache* take_parked(unsigned allocator_index_capacity)
+{
+    static const bool verbose = false;
+
+    unsigned index;
+
+    pas_heap_lock_assert_held();
+
+    for (index = pas_thread_local_cache_num_parked; index--;) {
+        pas_thread_local_cache* result;
+        uintptr_t page_index;
+
+        result = parked_caches[index];
+        if (result->allocator_index_capacity < allocator_index_capacity)
+            continue;
+
+        if (verbose)
+            pas_log("[%d] Taking parked TLC %p\n", getpid(), result);
+
+        memmove(parked_caches + index, parked_caches + index + 1,
+                (pas_thread_local_cache_num_parked - index - 1) * sizeof(pas_thread_local_cache*));
+        memmove(parked_epochs + index, parked_epochs + index + 1,
+                (pas_thread_local_cache_num_parked - index - 1) * sizeof(uint64_t));
+        pas_thread_local_cache_num_parked--;
+
+        /* The scavenger may have decommitted some pages while the previous thread was using the cache. We
+           are not visible to it yet, so this does not need the scavenger lock. */
+        for (page_index = num_pages(result->allocator_index_capacity); page_index--;) {
+            if (pas_bitvector_get(result->pages_committed, page_index))
+                continue;
+            pas_page_malloc_commit_without_mprotect(
+                (char*)result + (page_index << pas_page_malloc_alignment_shift()),
+                pas_page_malloc_alignment(),
+                pas_may_mmap);
+            pas_bitvector_set(result->pages_committed, page_index, true);
+        }
+
+        result->deallocation_log_dirty = false;
+        result->num_logged_bytes = 0;
+        result->should_stop_some = false;
+        pas_zero_memory(result->should_stop_bitvector,
+                        PAS_BITVECTOR_NUM_BYTES(result->allocator_index_capacity));
+        pas_zero_memory(&result->telemetry, sizeof(result->telemetry));
+        return result;
+    }
+
+    return NULL;
+}
+
+static void destroy(pas_thread_local_cache* thread_local_cache, pas_lock_hold_mode heap_lock_hold_mode,
+                    bool should_park)
 {
     static const bool verbose = false;
     
@@ -131,8 +217,15 @@ static void destroy(pas_thread_local_cache* thread_local_cache, pas_lock_hold_mo
         pas_log("[%d] Destroying TLC %p\n", getpid(), thread_local_cache);
     
     pas_thread_local_cache_shrink(thread_local_cache, pas_lock_is_held);
+    pas_telemetry_did_destroy_thread_local_cache(&thread_local_cache->telemetry);
     pas_thread_local_cache_node_deallocate(thread_local_cache->node);
-    deallocate(thread_local_cache);
+    if (should_park) {
+        pas_thread_local_cache_template_allocator_index_capacity = PAS_MAX(
+            pas_thread_local_cache_template_allocator_index_capacity,
+            thread_local_cache->allocator_index_capacity);
+    }
+    if (!should_park || !park(thread_local_cache))
+        deallocate(thread_local_cache);
     pas_heap_lock_unlock_conditionally(heap_lock_hold_mode);
 }
 
@@ -158,7 +251,7 @@ static void destructor(void* arg)
 #endif
 
     if (((uintptr_t)thread_local_cache) != PAS_THREAD_LOCAL_CACHE_DESTROYED)
-        destroy(thread_local_cache, pas_lock_is_not_held);
+        destroy(thread_local_cache, pas_lock_is_not_held, false);
     else {
         if (verbose)
             pas_log("[%d] Repeated destructor call for TLS %p\n", getpid(), thread_local_cache);
@@ -239,7 +332,11 @@ pas_thread_local_cache* pas_thread_local_cache_create(void)
 
     allocator_index_upper_bound = pas_thread_local_cache_layout_next_allocator_index;
     
-    thread_local_cache = allocate_cache(allocator_index_upper_bound);
+    thread_local_cache = take_parked(allocator_index_upper_bound);
+    if (!thread_local_cache) {
+        thread_local_cache = allocate_cache(
+            PAS_MAX(allocator_index_upper_bound, pas_thread_local_cache_template_allocator_index_capacity));
+    }
     
     thread_local_cache->node = pas_thread_local_cache_node_allocate();
 
@@ -267,7 +364,7 @@ pas_thread_local_cache* pas_thread_local_cache_create(void)
     return thread_local_cache;
 }
 
-void pas_thread_local_cache_destroy(pas_lock_hold_mode heap_lock_hold_mode)
+static void destroy_current(pas_lock_hold_mode heap_lock_hold_mode, bool should_park)
 {
     static const bool verbose = false;
     
@@ -282,7 +379,49 @@ void pas_thread_local_cache_destroy(pas_lock_hold_mode heap_lock_hold_mode)
 
     if (verbose)
         pas_log("[%d] TLC %p getting destroyed\n", getpid(), thread_local_cache);
-    destroy(thread_local_cache, heap_lock_hold_mode);
+    destroy(thread_local_cache, heap_lock_hold_mode, should_park);
+}
+
+void pas_thread_local_cache_destroy(pas_lock_hold_mode heap_lock_hold_mode)
+{
+    destroy_current(heap_lock_hold_mode, false);
+}
+
+void pas_thread_local_cache_donate(void)
+{
+    destroy_current(pas_lock_is_not_held, true);
+    pas_scavenger_notify_eligibility_if_needed();
+}
+
+bool pas_thread_local_cache_trim_parked(uint64_t max_epoch, pas_lock_hold_mode heap_lock_hold_mode)
+{
+    static const bool verbose = false;
+
+    unsigned index;
+    unsigned num_kept;
+    bool result;
+
+    pas_heap_lock_lock_conditionally(heap_lock_hold_mode);
+
+    num_kept = 0;
+    for (index = 0; index < pas_thread_local_cache_num_parked; ++index) {
+        if (parked_epochs[index] > max_epoch) {
+            parked_caches[num_kept] = parked_caches[index];
+            parked_epochs[num_kept] = parked_epochs[index];
+            num_kept++;
+            continue;
+        }
+
+        if (verbose)
+            pas_log("[%d] Freeing parked TLC %p\n", getpid(), parked_caches[index]);
+        deallocate(parked_caches[index]);
+    }
+    pas_thread_local_cache_num_parked = num_kept;
+    result = !!num_kept;
+
+    pas_heap_lock_unlock_conditionally(heap_lock_hold_mode);
+
+    return result;
 }
 
 pas_thread_local_cache* pas_thread_local_cache_get_slow(const pas_heap_config* config,
@@ -355,6 +494,8 @@ pas_local_allocator_result pas_thread_local_cache_get_local_allocator_slow(
         new_thread_local_cache->allocator_index_upper_bound =
             thread_local_cache->allocator_index_upper_bound;
 
+        new_thread_local_cache->telemetry = thread_local_cache->telemetry;
+
         pas_local_allocator_construct_unselected(
             (pas_local_allocator*)pas_thread_local_cache_get_local_allocator_direct_unchecked(
                 new_thread_local_cache, PAS_LOCAL_ALLOCATOR_UNSELECTED_INDEX));
@@ -771,6 +912,12 @@ static PAS_ALWAYS_INLINE void flush_deallocation_log_with_mode(
             thread_local_cache, pas_segregated_deallocation_to_view_cache_mode);
         break;
     }
+
+    /* The scavenger may have already processed some of these entries, but it never reuses a slot, so
+       the index is exactly the number of deallocations logged since the last flush. */
+    pas_telemetry_add_owned(&thread_local_cache->telemetry.num_deallocation_log_flushes, 1);
+    pas_telemetry_add_owned(&thread_local_cache->telemetry.num_logged_deallocations,
+                            thread_local_cache->deallocation_log_index);
     
     thread_local_cache->deallocation_log_index = 0;
     thread_local_cache->num_logged_bytes = 0;
@@ -37,6 +37,7 @@
 #include "pas_local_allocator_result.h"
 #include "pas_malloc_stack_logging.h"
 #include "pas_segregated_page_config_kind_and_role.h"
+#include "pas_telemetry.h"
 #include "pas_utils.h"
 
 #include "pas_thread.h"
@@ -76,6 +77,9 @@ struct pas_thread_local_cache {
     
     unsigned allocator_index_upper_bound;
     unsigned allocator_index_capacity;
+
+    pas_telemetry_thread_local_cache_counters telemetry;
+
     uint64_t local_allocators[1]; /* This is variable-length. */
 };
 
@@ -129,12 +133,38 @@ static inline void pas_thread_local_cache_set(pas_thread_local_cache* thread_loc
     pas_thread_local_cache_set_impl(thread_local_cache);
 }
 
+/* Caches handed over by pas_thread_local_cache_donate() are parked until a new thread needs one. Parking
+   keeps their pages committed and their capacity, so the next thread does not have to allocate, zero and
+   fault in a fresh cache. The scavenger frees caches that stay parked for longer than it keeps other dirty
+   memory around. */
+#define PAS_THREAD_LOCAL_CACHE_MAX_NUM_PARKED 16
+
+PAS_API extern unsigned pas_thread_local_cache_max_num_parked; /* At most PAS_THREAD_LOCAL_CACHE_MAX_NUM_PARKED.
+                                                                  Zero disables parking. */
+PAS_API extern unsigned pas_thread_local_cache_num_parked; /* Protected by the heap lock. */
+
+/* New caches get at least this much allocator index capacity, so that they do not have to be reallocated
+   when the layout grows after they are created. pas_thread_local_cache_donate() raises it to the capacity
+   of the donated cache, which makes the donating thread's cache the template for new ones. Embedders that
+   know how many allocators their threads will need can also set it directly. Protected by the heap lock. */
+PAS_API extern unsigned pas_thread_local_cache_template_allocator_index_capacity;
+
 PAS_API size_t pas_thread_local_cache_size_for_allocator_index_capacity(unsigned allocator_index_capacity);
 
 PAS_API pas_thread_local_cache* pas_thread_local_cache_create(void);
 
 PAS_API void pas_thread_local_cache_destroy(pas_lock_hold_mode heap_lock_hold_mode);
 
+/* Call this on a thread that is about to exit, or to stop allocating for a long time. It returns the
+   objects held by the thread's local allocators and deallocation log to the shared directories right away,
+   instead of when the thread's TLS is torn down, and parks the cache for the next thread that creates one.
+   If the thread allocates again, it simply gets a new cache. */
+PAS_API void pas_thread_local_cache_donate(void);
+
+/* Frees the parked caches that were parked at or before max_epoch. Returns true if some caches are still
+   parked. */
+PAS_API bool pas_thread_local_cache_trim_parked(uint64_t max_epoch, pas_lock_hold_mode heap_lock_hold_mode);
+
 PAS_API pas_thread_local_cache* pas_thread_local_cache_get_slow(
     const pas_heap_config* config, pas_lock_hold_mode heap_lock_hold_mode);
 
@@ -1057,6 +1057,28 @@ PAS_IGNORE_WARNINGS_END
 #endif
 }
 
+static inline uint64_t pas_atomic_load_uint64_relaxed(uint64_t* ptr)
+{
+#if PAS_COMPILER(CLANG)
+PAS_IGNORE_WARNINGS_BEGIN("atomic-alignment")
+    return __c11_atomic_load((_Atomic uint64_t*)ptr, __ATOMIC_RELAXED);
+PAS_IGNORE_WARNINGS_END
+#else
+    return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline void pas_atomic_store_uint64_relaxed(uint64_t* ptr, uint64_t value)
+{
+#if PAS_COMPILER(CLANG)
+PAS_IGNORE_WARNINGS_BEGIN("atomic-alignment")
+    __c11_atomic_store((_Atomic uint64_t*)ptr, value, __ATOMIC_RELAXED);
+PAS_IGNORE_WARNINGS_END
+#else
+    __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+#endif
+}
+
 static PAS_ALWAYS_INLINE bool pas_compare_ptr_opaque(uintptr_t a, uintptr_t b)
 {
 #if PAS_COMPILER(CLANG)
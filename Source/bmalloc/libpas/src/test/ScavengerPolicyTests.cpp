@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TestHarness.h"
+
+#include "pas_scavenger_policy.h"
+
+using namespace std;
+
+namespace {
+
+constexpr uint64_t baseDelta = 300ll * 1000ll * 1000ll;
+constexpr size_t limit = 1024 * 1024 * 1024;
+
+// Stands in for the cgroup memory.current and memory.max files.
+size_t simulatedCurrentBytes;
+size_t simulatedLimitBytes;
+
+extern "C" bool simulatedMemoryLimit(pas_scavenger_memory_limit_status* status)
+{
+    if (!simulatedLimitBytes)
+        return false;
+    status->current_bytes = simulatedCurrentBytes;
+    status->limit_bytes = simulatedLimitBytes;
+    return true;
+}
+
+uint64_t computeDelta(size_t currentBytes, size_t limitBytes, double commitRate)
+{
+    pas_scavenger_memory_limit_status status;
+    status.current_bytes = currentBytes;
+    status.limit_bytes = limitBytes;
+    return pas_scavenger_policy_compute_max_epoch_delta(baseDelta, status, commitRate);
+}
+
+void testNoLimitKeepsBaseDelta()
+{
+    CHECK_EQUAL(computeDelta(0, 0, 0.), baseDelta);
+    CHECK_EQUAL(computeDelta(limit, 0, 1000000.), baseDelta);
+}
+
+void testHeadroomWithoutCommitsKeepsBaseDelta()
+{
+    CHECK_EQUAL(computeDelta(limit / 4, limit, 0.), baseDelta);
+    CHECK_EQUAL(computeDelta(limit / 2, limit, 0.), baseDelta);
+}
+
+void testDeltaShrinksAsUsageApproachesLimit()
+{
+    uint64_t previousDelta = baseDelta;
+    for (double usage = .75; usage < 1.; usage += .01) {
+        uint64_t delta = computeDelta(static_cast<size_t>(limit * usage), limit, 0.);
+        CHECK_LESS_EQUAL(delta, previousDelta);
+        previousDelta = delta;
+    }
+    CHECK_LESS(computeDelta(limit / 100 * 85, limit, 0.), baseDelta);
+    CHECK_EQUAL(computeDelta(limit / 100 * 96, limit, 0.), 0u);
+    CHECK_EQUAL(computeDelta(limit, limit, 0.), 0u);
+    CHECK_EQUAL(computeDelta(limit * 2, limit, 0.), 0u);
+}
+
+void testHighCommitRateWithHeadroomIsLazier()
+{
+    double highRate = pas_scavenger_policy_high_commit_rate_in_bytes_per_millisecond;
+
+    CHECK_GREATER(computeDelta(limit / 4, limit, highRate / 2), baseDelta);
+    CHECK_EQUAL(computeDelta(limit / 4, limit, highRate),
+                static_cast<uint64_t>(baseDelta * pas_scavenger_policy_max_lazy_factor));
+    CHECK_EQUAL(computeDelta(limit / 4, limit, highRate * 2),
+                static_cast<uint64_t>(baseDelta * pas_scavenger_policy_max_lazy_factor));
+}
+
+void testCommitRateNearLimitDecommitsSooner()
+{
+    // At this rate, we use up the remaining half of the limit in 100ms, so we should not wait longer than half of that.
+    double rate = static_cast<double>(limit / 2) / 100.;
+    CHECK_LESS_EQUAL(computeDelta(limit / 2, limit, rate), 50u * 1000u * 1000u);
+}
+
+void testSimulatedPressure()
+{
+    simulatedCurrentBytes = 0;
+    simulatedLimitBytes = limit;
+    pas_scavenger_policy_memory_limit_callback = simulatedMemoryLimit;
+
+    pas_scavenger_policy_state state = PAS_SCAVENGER_POLICY_STATE_INITIALIZER;
+    double time = 0.;
+    uint64_t committedBytes = 0;
+
+    CHECK_EQUAL(pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time, committedBytes), baseDelta);
+
+    // Commit quickly while there is plenty of headroom. The scavenger should back off.
+    for (unsigned i = 0; i < 5; ++i) {
+        time += 100.;
+        committedBytes += 64 * 1024 * 1024;
+        simulatedCurrentBytes += 64 * 1024 * 1024;
+        pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time, committedBytes);
+    }
+    CHECK_GREATER(state.max_epoch_delta, baseDelta);
+
+    // The limit is not sampled again until the sample period has passed.
+    simulatedCurrentBytes = limit;
+    CHECK_EQUAL(pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time + 1., committedBytes),
+                state.max_epoch_delta);
+    CHECK_NOT_EQUAL(state.max_epoch_delta, 0u);
+
+    // Now we are at the limit. Everything free should be decommitted right away.
+    time += pas_scavenger_policy_sample_period_in_milliseconds;
+    CHECK_EQUAL(pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time, committedBytes), 0u);
+
+    // Stop committing and free up memory. We go back to the base delay.
+    simulatedCurrentBytes = limit / 4;
+    for (unsigned i = 0; i < 20; ++i) {
+        time += 100.;
+        pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time, committedBytes);
+    }
+    CHECK_LESS(state.commit_rate_in_bytes_per_millisecond, 1.);
+    CHECK_LESS_EQUAL(state.max_epoch_delta - baseDelta, baseDelta / 1000);
+
+    // A disabled policy leaves the delay alone.
+    simulatedCurrentBytes = limit;
+    pas_scavenger_policy_is_enabled = false;
+    time += 100.;
+    CHECK_EQUAL(pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time, committedBytes), baseDelta);
+    pas_scavenger_policy_is_enabled = true;
+}
+
+void testDecommitsOffsetCommits()
+{
+    simulatedCurrentBytes = limit / 4;
+    simulatedLimitBytes = limit;
+    pas_scavenger_policy_memory_limit_callback = simulatedMemoryLimit;
+
+    pas_scavenger_policy_state state = PAS_SCAVENGER_POLICY_STATE_INITIALIZER;
+    double time = 0.;
+    uint64_t netCommittedBytes = 256 * 1024 * 1024;
+
+    pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time, netCommittedBytes);
+
+    // Committing and decommitting the same pages over and over is not growth, so we should not back off.
+    for (unsigned i = 0; i < 5; ++i) {
+        time += 100.;
+        pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time, netCommittedBytes);
+    }
+    CHECK_EQUAL(state.commit_rate_in_bytes_per_millisecond, 0.);
+    CHECK_EQUAL(state.max_epoch_delta, baseDelta);
+
+    // Decommitting more than we commit gives a negative rate, which also keeps the base delay.
+    for (unsigned i = 0; i < 3; ++i) {
+        time += 100.;
+        netCommittedBytes -= 64 * 1024 * 1024;
+        pas_scavenger_policy_select_max_epoch_delta(&state, baseDelta, time, netCommittedBytes);
+    }
+    CHECK_LESS(state.commit_rate_in_bytes_per_millisecond, 0.);
+    CHECK_EQUAL(state.max_epoch_delta, baseDelta);
+}
+
+} // anonymous namespace
+
+void addScavengerPolicyTests()
+{
+    ADD_TEST(testNoLimitKeepsBaseDelta());
+    ADD_TEST(testHeadroomWithoutCommitsKeepsBaseDelta());
+    ADD_TEST(testDeltaShrinksAsUsageApproachesLimit());
+    ADD_TEST(testHighCommitRateWithHeadroomIsLazier());
+    ADD_TEST(testCommitRateNearLimitDecommitsSooner());
+    ADD_TEST(testSimulatedPressure());
+    ADD_TEST(testDecommitsOffsetCommits());
+}
@@ -29,11 +29,13 @@
 
 #include "bmalloc_heap.h"
 #include "bmalloc_heap_config.h"
+#include <atomic>
 #include <functional>
 #include "pas_all_heaps.h"
 #include "pas_baseline_allocator_table.h"
 #include "pas_bitvector.h"
 #include "pas_committed_pages_vector.h"
+#include "pas_epoch.h"
 #include "pas_get_heap.h"
 #include "pas_get_page_base.h"
 #include "pas_heap_lock.h"
@@ -426,6 +428,98 @@ void testAllocateFromStoppedBaselineDuringThreadDestruction()
     myThread.join();
 }
 
+pas_heap_ref createDonationTestHeap()
+{
+    return BMALLOC_HEAP_REF_INITIALIZER(
+        new bmalloc_type(BMALLOC_TYPE_INITIALIZER(32, 1, "test")),
+        pas_bmalloc_heap_ref_kind_non_compact);
+}
+
+pas_thread_local_cache* allocateThenDonate(pas_heap_ref* heapRef)
+{
+    void* ptr = bmalloc_iso_allocate(heapRef, pas_non_compact_allocation_mode);
+    CHECK(ptr);
+    bmalloc_deallocate(ptr);
+
+    pas_thread_local_cache* cache = pas_thread_local_cache_try_get();
+    CHECK(cache);
+    CHECK(cache->deallocation_log_index);
+
+    pas_thread_local_cache_donate();
+    CHECK(!pas_thread_local_cache_try_get());
+    return cache;
+}
+
+void testDonateThenReuseInThread()
+{
+    pas_scavenger_suspend();
+
+    pas_heap_ref heapRef = createDonationTestHeap();
+
+    pas_thread_local_cache* donatedCache = nullptr;
+    thread([&] () {
+        donatedCache = allocateThenDonate(&heapRef);
+    }).join();
+
+    CHECK_EQUAL(pas_thread_local_cache_num_parked, 1u);
+    CHECK(!donatedCache->deallocation_log_index);
+    CHECK_GREATER_EQUAL(pas_thread_local_cache_template_allocator_index_capacity,
+                        donatedCache->allocator_index_capacity);
+
+    thread([&] () {
+        void* ptr = bmalloc_iso_allocate(&heapRef, pas_non_compact_allocation_mode);
+        CHECK(ptr);
+        CHECK_EQUAL(pas_thread_local_cache_try_get(), donatedCache);
+        bmalloc_deallocate(ptr);
+    }).join();
+
+    CHECK_EQUAL(pas_thread_local_cache_num_parked, 0u);
+}
+
+void testDonateThenTrim()
+{
+    pas_scavenger_suspend();
+
+    pas_heap_ref heapRef = createDonationTestHeap();
+
+    thread([&] () {
+        allocateThenDonate(&heapRef);
+    }).join();
+
+    CHECK_EQUAL(pas_thread_local_cache_num_parked, 1u);
+    CHECK(pas_thread_local_cache_trim_parked(PAS_EPOCH_INVALID, pas_lock_is_not_held));
+    CHECK_EQUAL(pas_thread_local_cache_num_parked, 1u);
+    CHECK(!pas_thread_local_cache_trim_parked(PAS_EPOCH_MAX, pas_lock_is_not_held));
+    CHECK_EQUAL(pas_thread_local_cache_num_parked, 0u);
+}
+
+void testDonateMoreThanMaxNumParked(unsigned maxNumParked, unsigned numThreads)
+{
+    pas_scavenger_suspend();
+
+    pas_thread_local_cache_max_num_parked = maxNumParked;
+
+    pas_heap_ref heapRef = createDonationTestHeap();
+
+    // All threads have to hold a cache at the same time, or they would just pass the same one around.
+    atomic<unsigned> numAllocated { 0 };
+    vector<thread> threads;
+    for (unsigned index = numThreads; index--;) {
+        threads.push_back(thread([&] () {
+            void* ptr = bmalloc_iso_allocate(&heapRef, pas_non_compact_allocation_mode);
+            CHECK(ptr);
+            numAllocated++;
+            while (numAllocated.load() < numThreads) { }
+            bmalloc_deallocate(ptr);
+            pas_thread_local_cache_donate();
+        }));
+    }
+    for (thread& thread : threads)
+        thread.join();
+
+    CHECK_EQUAL(pas_thread_local_cache_num_parked, min(maxNumParked, numThreads));
+}
+
 } // anonymous namespace
 
 #endif // PAS_ENABLE_BMALLOC
@@ -481,5 +575,11 @@ void addTLCDecommitTests()
         ADD_TEST(testAllocateFromStoppedBaseline());
         ADD_TEST(testAllocateFromStoppedBaselineDuringThreadDestruction());
     }
+
+    ADD_TEST(testDonateThenReuseInThread());
+    ADD_TEST(testDonateThenTrim());
+    ADD_TEST(testDonateMoreThanMaxNumParked(1, 3));
+    ADD_TEST(testDonateMoreThanMaxNumParked(4, 2));
+    ADD_TEST(testDonateMoreThanMaxNumParked(0, 2));
 #endif // PAS_ENABLE_BMALLOC
 }
@@ -374,6 +374,7 @@ void addPGMTests();
 void addRaceTests();
 void addRedBlackTreeTests();
 void addScavengerExternalWorkTests();
+void addScavengerPolicyTests();
 void addTLCDecommitTests();
 void addTSDTests();
 void addThingyAndUtilityHeapAllocationTests();
@@ -744,6 +745,7 @@ int main(int argc, char** argv)
     ADD_SUITE(PGM);
     ADD_SUITE(Race);
     ADD_SUITE(RedBlackTree);
+    ADD_SUITE(ScavengerPolicy);
     ADD_SUITE(TLCDecommit);
     ADD_SUITE(TSD);
     ADD_SUITE(Utils);
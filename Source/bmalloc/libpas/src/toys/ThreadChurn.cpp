@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL APPLE INC. OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+ * OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pas_thread_local_cache.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Measures how fast short-lived worker threads can be spun up and down, which is dominated by creating
+// and destroying their thread local caches. It allocates through whichever mbmalloc library it is linked
+// against, like MallocBench does. For example:
+//
+//     ./thread_churn -numJobs 100000 -numConcurrentJobs 4 -donate 1
+//
+// See FOR_EACH_ARG for all the options.
+
+extern "C" {
+void* mbmalloc(size_t);
+void mbfree(void*, size_t);
+}
+
+namespace {
+
+#define FOR_EACH_ARG(macro) \
+    macro(uintptr_t,     seed,                           666,             "%lu") \
+    macro(uintptr_t,     numJobs,                        20000,           "%lu") \
+    macro(uintptr_t,     numConcurrentJobs,              4,               "%lu") \
+    macro(uintptr_t,     numObjectsPerJob,               1000,            "%lu") \
+    macro(uintptr_t,     maxObjectSize,                  512,             "%lu") \
+    macro(unsigned,      donate,                         1,               "%u") \
+    macro(unsigned,      maxNumParked,                   4,               "%u")
+
+#define DECLARE_ARG(type, name, initialValue, format) \
+    type name = initialValue;
+FOR_EACH_ARG(DECLARE_ARG)
+#undef DECLARE_ARG
+
+void runJob(uintptr_t jobIndex)
+{
+    mt19937 random(static_cast<unsigned>(seed + jobIndex));
+    uniform_int_distribution<size_t> sizeDistribution(1, maxObjectSize);
+
+    vector<pair<void*, size_t>> objects;
+    objects.reserve(numObjectsPerJob);
+    for (uintptr_t index = numObjectsPerJob; index--;) {
+        size_t size = sizeDistribution(random);
+        void* object = mbmalloc(size);
+        PAS_ASSERT(object);
+        memset(object, 42, size);
+        objects.push_back(make_pair(object, size));
+    }
+    for (auto& object : objects)
+        mbfree(object.first, object.second);
+
+    if (donate)
+        pas_thread_local_cache_donate();
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    for (int argIndex = 1; argIndex < argc;) {
+        char* argName = argv[argIndex++];
+
+#define HANDLE_ARG(type, name, initialValue, format) \
+        if (!strcmp(argName, "-" #name)) { \
+            if (argIndex >= argc) { \
+                cerr << "Need argument for -" #name "\n"; \
+                return 1; \
+            } \
+            char* argValue = argv[argIndex++]; \
+            if (sscanf(argValue, format, &name) != 1) { \
+                cerr << "Badly formatted argument for -" #name ": " << argValue << "\n"; \
+                return 1; \
+            } \
+            continue; \
+        }
+        FOR_EACH_ARG(HANDLE_ARG)
+#undef HANDLE_ARG
+
+        if (!strcmp(argName, "-help")) {
+            cout << "Usage: thread_churn [options]\n";
+            cout << "\n";
+            cout << "Options:\n";
+#define REPORT_ARG(type, name, initialValue, format) \
+            printf("-%s <arg>     (type %s and initial value " format ")\n", #name, #type, type(initialValue));
+            FOR_EACH_ARG(REPORT_ARG)
+#undef REPORT_ARG
+            return 2;
+        }
+
+        cerr << "Bad argument: " << argName << " (try -help)\n";
+        return 1;
+    }
+
+    if (!numConcurrentJobs) {
+        cerr << "-numConcurrentJobs must be positive\n";
+        return 1;
+    }
+    if (maxNumParked > PAS_THREAD_LOCAL_CACHE_MAX_NUM_PARKED) {
+        cerr << "-maxNumParked must be at most " << PAS_THREAD_LOCAL_CACHE_MAX_NUM_PARKED << "\n";
+        return 1;
+    }
+
+    pas_thread_local_cache_max_num_parked = maxNumParked;
+
+#define REPORT_ARG(type, name, initialValue, format) \
+    printf("%s = " format "\n", #name, name);
+    FOR_EACH_ARG(REPORT_ARG);
+#undef REPORT_ARG
+
+    auto before = chrono::steady_clock::now();
+
+    for (uintptr_t firstJob = 0; firstJob < numJobs; firstJob += numConcurrentJobs) {
+        vector<thread> threads;
+        for (uintptr_t jobIndex = firstJob; jobIndex < min(firstJob + numConcurrentJobs, numJobs); ++jobIndex)
+            threads.push_back(thread(runJob, jobIndex));
+        for (thread& someThread : threads)
+            someThread.join();
+    }
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - before).count();
+    printf("Ran %lu jobs in %.3lf seconds: %.0lf jobs/sec, %.2lf us per job.\n",
+           numJobs, seconds, numJobs / seconds, seconds * 1e6 / numJobs);
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Apple Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Test.h"
+#include <wtf/SwissHashMap.h>
+#include <wtf/SwissHashSet.h>
+#include <wtf/Vector.h>
+
+namespace TestWebKitAPI {
+
+// Puts every key in the same group, with the same control byte, so that groups fill up.
+struct CollidingHash {
+    static unsigned hash(unsigned) { return 0; }
+    static bool equal(unsigned a, unsigned b) { return a == b; }
+    static constexpr bool safeToCompareToEmptyOrDeleted = true;
+};
+
+TEST(WTF_SwissHashMap, InsertAndFind)
+{
+    SwissHashMap<unsigned, unsigned> map;
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(1));
+
+    for (unsigned i = 1; i <= 1000; ++i) {
+        auto result = map.add(i, i * 2);
+        EXPECT_TRUE(result.isNewEntry);
+        EXPECT_EQ(i, result.iterator->key);
+    }
+    EXPECT_EQ(1000u, map.size());
+
+    auto result = map.add(500, 0);
+    EXPECT_FALSE(result.isNewEntry);
+    EXPECT_EQ(1000u, result.iterator->value);
+
+    for (unsigned i = 1; i <= 1000; ++i)
+        EXPECT_EQ(i * 2, map.get(i));
+    for (unsigned i = 1001; i <= 2000; ++i)
+        EXPECT_FALSE(map.contains(i));
+
+    map.set(500, 7);
+    EXPECT_EQ(7u, map.get(500));
+    EXPECT_EQ(1000u, map.size());
+}
+
+TEST(WTF_SwissHashMap, Erase)
+{
+    SwissHashMap<unsigned, unsigned> map;
+    for (unsigned i = 1; i <= 1000; ++i)
+        map.add(i, i);
+
+    for (unsigned i = 2; i <= 1000; i += 2)
+        EXPECT_TRUE(map.remove(i));
+    EXPECT_FALSE(map.remove(2));
+    EXPECT_FALSE(map.remove(5000));
+    EXPECT_EQ(500u, map.size());
+
+    for (unsigned i = 1; i <= 1000; ++i)
+        EXPECT_EQ(i % 2, map.contains(i));
+
+    EXPECT_EQ(1u, map.take(1));
+    EXPECT_FALSE(map.contains(1));
+
+    map.removeIf([](auto& entry) {
+        return entry.key % 3;
+    });
+    for (unsigned i = 1; i <= 1000; ++i)
+        EXPECT_EQ(i % 2 && !(i % 3), map.contains(i));
+}
+
+TEST(WTF_SwissHashMap, TombstoneReuse)
+{
+    // 20 colliding keys fill their group in a 32-bucket table, so removing one of the first 16 leaves a
+    // tombstone. Adding another colliding key must reuse that bucket instead of using up the other group.
+    SwissHashMap<unsigned, unsigned, CollidingHash> map;
+    for (unsigned i = 1; i <= 20; ++i)
+        map.add(i, i);
+    unsigned capacity = map.capacity();
+    EXPECT_EQ(32u, capacity);
+
+    unsigned nextKey = 21;
+    for (unsigned i = 0; i < 1000; ++i) {
+        // Iteration visits buckets in order, so the first 16 keys are the full group.
+        Vector<unsigned> keys = copyToVector(map.keys());
+        unsigned position = i % 16;
+        unsigned removedKey = keys[position];
+        EXPECT_TRUE(map.remove(removedKey));
+        EXPECT_TRUE(map.add(nextKey, nextKey).isNewEntry);
+        EXPECT_FALSE(map.contains(removedKey));
+        EXPECT_EQ(nextKey, copyToVector(map.keys())[position]);
+        ++nextKey;
+        EXPECT_EQ(20u, map.size());
+        EXPECT_EQ(capacity, map.capacity());
+    }
+
+    for (unsigned key : copyToVector(map.keys()))
+        EXPECT_EQ(key, map.get(key));
+}
+
+TEST(WTF_SwissHashMap, LookupPastTombstones)
+{
+    SwissHashMap<unsigned, unsigned, CollidingHash> map;
+    for (unsigned i = 1; i <= 20; ++i)
+        map.add(i, i);
+
+    // Keys 17 to 20 live in the second group. Removing keys from the full first group must not cut off the probe.
+    for (unsigned i = 1; i <= 8; ++i)
+        map.remove(i);
+    for (unsigned i = 9; i <= 20; ++i)
+        EXPECT_EQ(i, map.get(i));
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_FALSE(map.add(20, 0).isNewEntry);
+}
+
+TEST(WTF_SwissHashMap, Rehash)
+{
+    SwissHashMap<unsigned, std::unique_ptr<unsigned>> map;
+    unsigned previousCapacity = 0;
+    unsigned growCount = 0;
+    for (unsigned i = 1; i <= 10000; ++i) {
+        map.add(i, std::make_unique<unsigned>(i));
+        if (map.capacity() != previousCapacity) {
+            ++growCount;
+            previousCapacity = map.capacity();
+        }
+        EXPECT_LE(map.size() * 8, map.capacity() * 7);
+    }
+    EXPECT_GT(growCount, 5u);
+    for (unsigned i = 1; i <= 10000; ++i)
+        EXPECT_EQ(i, *map.get(i));
+
+    unsigned grownCapacity = map.capacity();
+    for (unsigned i = 11; i <= 10000; ++i)
+        map.remove(i);
+    EXPECT_LT(map.capacity(), grownCapacity);
+    EXPECT_EQ(10u, map.size());
+    for (unsigned i = 1; i <= 10; ++i)
+        EXPECT_EQ(i, *map.get(i));
+
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(1));
+    map.add(1, std::make_unique<unsigned>(1));
+    EXPECT_EQ(1u, *map.get(1));
+}
+
+TEST(WTF_SwissHashMap, Iteration)
+{
+    SwissHashMap<unsigned, unsigned> map;
+    EXPECT_TRUE(map.begin() == map.end());
+
+    for (unsigned i = 1; i <= 1000; ++i)
+        map.add(i, i);
+
+    auto sumOfKeys = [&] {
+        uint64_t sum = 0;
+        unsigned count = 0;
+        for (auto& entry : map) {
+            EXPECT_EQ(entry.key, entry.value);
+            sum += entry.key;
+            ++count;
+        }
+        EXPECT_EQ(map.size(), count);
+        return sum;
+    };
+    EXPECT_EQ(500500u, sumOfKeys());
+
+    for (unsigned i = 1; i <= 1000; i += 3)
+        map.remove(i);
+    uint64_t expected = 0;
+    for (unsigned i = 1; i <= 1000; ++i) {
+        if ((i - 1) % 3)
+            expected += i;
+    }
+    EXPECT_EQ(expected, sumOfKeys());
+
+    Vector<unsigned> keys = copyToVector(map.keys());
+    EXPECT_EQ(map.size(), keys.size());
+    for (unsigned key : keys)
+        EXPECT_TRUE(map.contains(key));
+}
+
+TEST(WTF_SwissHashMap, IterationWithTombstones)
+{
+    SwissHashMap<unsigned, unsigned, CollidingHash> map;
+    for (unsigned i = 1; i <= 20; ++i)
+        map.add(i, i);
+    for (unsigned i = 1; i <= 20; i += 2)
+        map.remove(i);
+
+    unsigned count = 0;
+    for (auto& entry : map) {
+        EXPECT_FALSE(entry.key % 2);
+        ++count;
+    }
+    EXPECT_EQ(10u, count);
+}
+
+TEST(WTF_SwissHashSet, Basic)
+{
+    SwissHashSet<unsigned> set;
+    for (unsigned i = 1; i <= 100; ++i)
+        EXPECT_TRUE(set.add(i).isNewEntry);
+    EXPECT_FALSE(set.add(50).isNewEntry);
+    EXPECT_EQ(100u, set.size());
+    for (unsigned i = 1; i <= 100; i += 2)
+        EXPECT_TRUE(set.remove(i));
+    for (unsigned i = 1; i <= 100; ++i)
+        EXPECT_EQ(!(i % 2), set.contains(i));
+}
+
+} // namespace TestWebKitAPI